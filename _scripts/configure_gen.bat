@@ -1,49 +1,49 @@
-@echo off
-
-setlocal
-
-call "%%~dp0__init__.bat" || goto :EOF
-
-set /A NEST_LVL+=1
-
-set "CONFIGURE_FILE_IN=%~dp0..\%~nx0.in"
-
-rem for safe parse
-setlocal ENABLEDELAYEDEXPANSION
-
-rem load command line from file
-set "CMAKE_CMD_LINE="
-for /F "usebackq eol=# tokens=* delims=" %%i in ("%CONFIGURE_FILE_IN%") do (
-  if defined CMAKE_CMD_LINE (
-    set "CMAKE_CMD_LINE=!CMAKE_CMD_LINE! %%i"
-  ) else (
-    set "CMAKE_CMD_LINE=%%i"
-  )
-)
-
-rem safe variable return over endlocal with delayed expansion
-for /F "eol=# tokens=* delims=" %%i in ("!CMAKE_CMD_LINE!") do (
-  endlocal
-  set "CMAKE_CMD_LINE=%%i"
-)
-
-pushd "%CMAKE_BUILD_ROOT%" && (
-  (
-    call :CMD cmake %CMAKE_CMD_LINE%
-  ) || ( popd & goto EXIT )
-  popd
-)
-
-:EXIT
-set /A NEST_LVL-=1
-
-if %NEST_LVL% EQU 0 pause
-
-exit /b
-
-:CMD
-echo.^>%*
-(
-  %*
-)
-exit /b
+@echo off
+
+setlocal
+
+call "%%~dp0__init__.bat" || goto :EOF
+
+set /A NEST_LVL+=1
+
+set "CONFIGURE_FILE_IN=%~dp0..\%~nx0.in"
+
+rem for safe parse
+setlocal ENABLEDELAYEDEXPANSION
+
+rem load command line from file
+set "CMAKE_CMD_LINE="
+for /F "usebackq eol=# tokens=* delims=" %%i in ("%CONFIGURE_FILE_IN%") do (
+  if defined CMAKE_CMD_LINE (
+    set "CMAKE_CMD_LINE=!CMAKE_CMD_LINE! %%i"
+  ) else (
+    set "CMAKE_CMD_LINE=%%i"
+  )
+)
+
+rem safe variable return over endlocal with delayed expansion
+for /F "eol=# tokens=* delims=" %%i in ("!CMAKE_CMD_LINE!") do (
+  endlocal
+  set "CMAKE_CMD_LINE=%%i"
+)
+
+pushd "%CMAKE_BUILD_ROOT%" && (
+  (
+    call :CMD cmake %CMAKE_CMD_LINE%
+  ) || ( popd & goto EXIT )
+  popd
+)
+
+:EXIT
+set /A NEST_LVL-=1
+
+if %NEST_LVL% EQU 0 pause
+
+exit /b
+
+:CMD
+echo.^>%*
+(
+  %*
+)
+exit /b
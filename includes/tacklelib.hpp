@@ -1,3 +1,3 @@
-#pragma once
-
-#include <utility/platform.hpp>
+#pragma once
+
+#include <utility/platform.hpp>
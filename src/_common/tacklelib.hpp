@@ -1,6 +1,6 @@
-#pragma once
-
-#include <debug.hpp>        // debug switches
-#include <optimization.hpp> // optimization switches
-
-#include <utility/platform.hpp>
+#pragma once
+
+#include <debug.hpp>        // debug switches
+#include <optimization.hpp> // optimization switches
+
+#include <utility/platform.hpp>
@@ -0,0 +1,1078 @@
+#include <utility/bits.hpp>
+#include <utility/cpu.hpp>
+#include <utility/utility.hpp>
+#include <utility/assert.hpp>
+
+#include <cstring>
+#include <climits>
+#include <algorithm>
+
+
+namespace
+{
+    typedef void (* MirrorBitsFunc)(uint8_t * buf, size_t size);
+    typedef void (* SwapBytesFunc)(uint8_t * buf, size_t size, size_t word_size);
+    typedef void (* ReverseBitsInBytesFunc)(uint8_t * buf, size_t size);
+    typedef void (* PermuteBytesFunc)(uint8_t * buf, size_t size, const utility::BytePermutation & permutation);
+
+    FORCE_INLINE uint64_t _reverse_bits64(uint64_t value)
+    {
+        value = (value >> 32) | (value << 32);
+        value = ((value & 0xFFFF0000FFFF0000ULL) >> 16) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+        value = ((value & 0xFF00FF00FF00FF00ULL) >> 8) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+        value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >> 4) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        value = ((value & 0xCCCCCCCCCCCCCCCCULL) >> 2) | ((value & 0x3333333333333333ULL) << 2);
+        value = ((value & 0xAAAAAAAAAAAAAAAAULL) >> 1) | ((value & 0x5555555555555555ULL) << 1);
+        return value;
+    }
+
+    FORCE_INLINE uint16_t _byteswap16(uint16_t value)
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        return _byteswap_ushort(value);
+#else
+        return __builtin_bswap16(value);
+#endif
+    }
+
+    FORCE_INLINE uint32_t _byteswap32(uint32_t value)
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        return _byteswap_ulong(value);
+#else
+        return __builtin_bswap32(value);
+#endif
+    }
+
+    FORCE_INLINE uint64_t _byteswap64(uint64_t value)
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        return _byteswap_uint64(value);
+#else
+        return __builtin_bswap64(value);
+#endif
+    }
+
+    FORCE_INLINE uint64_t _load_be64(const uint8_t * buf)
+    {
+        uint64_t value;
+        memcpy(&value, buf, 8);
+        return _byteswap64(value);
+    }
+
+    FORCE_INLINE void _store_be64(uint8_t * buf, uint64_t value)
+    {
+        value = _byteswap64(value);
+        memcpy(buf, &value, 8);
+    }
+
+    // returns `num_bits` (1-64) bits from the bit offset as the low bits of the value, the first bit is the highest
+    FORCE_INLINE uint64_t _get_bits(const uint8_t * buf, size_t size, uint64_t bit_offset, size_t num_bits)
+    {
+        const size_t offset = size_t(bit_offset / CHAR_BIT);
+        const uint32_t shift = uint32_t(bit_offset % CHAR_BIT);
+
+        uint64_t value;
+        uint8_t next_byte;
+
+        if (offset + 9 <= size) {
+            value = _load_be64(buf + offset);
+            next_byte = buf[offset + 8];
+        }
+        else {
+            uint8_t bytes[9] = {};
+            memcpy(bytes, buf + offset, (std::min)(size - offset, size_t(9)));
+            value = _load_be64(bytes);
+            next_byte = bytes[8];
+        }
+
+        // funnel shift of the 9 bytes window
+        if (shift) {
+            value = (value << shift) | (next_byte >> (CHAR_BIT - shift));
+        }
+
+        return value >> (64 - num_bits);
+    }
+
+    // ors `num_bits` (1-64) low bits of the value into the zeroed bits from the bit offset
+    FORCE_INLINE void _put_bits(uint8_t * buf, uint64_t bit_offset, uint64_t value, size_t num_bits)
+    {
+        const size_t offset = size_t(bit_offset / CHAR_BIT);
+        const uint32_t shift = uint32_t(bit_offset % CHAR_BIT);
+
+        const uint64_t aligned_value = value << (64 - num_bits);
+
+        _store_be64(buf + offset, _load_be64(buf + offset) | (aligned_value >> shift));
+
+        if (shift) {
+            buf[offset + 8] |= uint8_t(aligned_value << (CHAR_BIT - shift));
+        }
+    }
+
+    FORCE_INLINE void _mirror_bit_range(const uint8_t * in_buf, size_t in_size, uint64_t in_bit_offset, uint8_t * out_buf, uint64_t out_bit_offset, size_t bit_size)
+    {
+        // the output word is the reversed input word from the range end
+        for (size_t done_size = 0; done_size < bit_size; done_size += 64) {
+            const size_t num_bits = (std::min)(bit_size - done_size, size_t(64));
+            const uint64_t value = _get_bits(in_buf, in_size, in_bit_offset + bit_size - done_size - num_bits, num_bits);
+            _put_bits(out_buf, out_bit_offset + done_size, _reverse_bits64(value) >> (64 - num_bits), num_bits);
+        }
+    }
+
+    // Hacker's Delight transposes by delta swaps
+    FORCE_INLINE uint64_t _transpose_bits8x8(uint64_t value)
+    {
+        uint64_t t;
+        t = (value ^ (value >> 7)) & 0x00AA00AA00AA00AAULL;
+        value ^= t ^ (t << 7);
+        t = (value ^ (value >> 14)) & 0x0000CCCC0000CCCCULL;
+        value ^= t ^ (t << 14);
+        t = (value ^ (value >> 28)) & 0x00000000F0F0F0F0ULL;
+        value ^= t ^ (t << 28);
+        return value;
+    }
+
+    FORCE_INLINE void _transpose_bits64x64(uint64_t * rows)
+    {
+        uint64_t mask = 0x00000000FFFFFFFFULL;
+        for (size_t j = 32; j; j >>= 1, mask ^= mask << j) {
+            for (size_t k = 0; k < 64; k = (k + j + 1) & ~j) {
+                const uint64_t t = (rows[k] ^ (rows[k + j] >> j)) & mask;
+                rows[k] ^= t;
+                rows[k + j] ^= t << j;
+            }
+        }
+    }
+
+    struct TransposeBitMatrix
+    {
+        const uint8_t * in_buf;
+        size_t row_size;
+        uint8_t * out_buf;
+        size_t out_stride;
+    };
+
+    // transposes the 64 rows block by the 8 bytes (64 columns) block
+    FORCE_INLINE void _transpose_bit_block64(const TransposeBitMatrix & matrix, size_t row, size_t col)
+    {
+        const size_t col_size = (std::min)(matrix.row_size - col, size_t(8));
+
+        uint64_t rows[64];
+
+        const uint8_t * in_buf = matrix.in_buf + row * matrix.row_size + col;
+        if (col_size == 8) {
+            for (size_t i = 0; i < 64; i++, in_buf += matrix.row_size) {
+                rows[i] = _load_be64(in_buf);
+            }
+        }
+        else {
+            for (size_t i = 0; i < 64; i++, in_buf += matrix.row_size) {
+                uint8_t bytes[8] = {};
+                memcpy(bytes, in_buf, col_size);
+                rows[i] = _load_be64(bytes);
+            }
+        }
+
+        _transpose_bits64x64(rows);
+
+        uint8_t * out_buf = matrix.out_buf + col * CHAR_BIT * matrix.out_stride + row / CHAR_BIT;
+        for (size_t i = 0; i < col_size * CHAR_BIT; i++, out_buf += matrix.out_stride) {
+            _store_be64(out_buf, rows[i]);
+        }
+    }
+
+    // splits the larger dimension until the tile fits the L1 cache
+    void _transpose_bit_tiles(const TransposeBitMatrix & matrix, size_t row_begin, size_t row_end, size_t col_begin, size_t col_end)
+    {
+        const size_t num_row_blocks = (row_end - row_begin) / 64;
+        const size_t num_col_blocks = (col_end - col_begin + 7) / 8;
+
+        if (num_row_blocks * num_col_blocks <= 4) {
+            for (size_t row = row_begin; row < row_end; row += 64) {
+                for (size_t col = col_begin; col < col_end; col += 8) {
+                    _transpose_bit_block64(matrix, row, col);
+                }
+            }
+        }
+        else if (num_row_blocks >= num_col_blocks) {
+            const size_t row_middle = row_begin + num_row_blocks / 2 * 64;
+            _transpose_bit_tiles(matrix, row_begin, row_middle, col_begin, col_end);
+            _transpose_bit_tiles(matrix, row_middle, row_end, col_begin, col_end);
+        }
+        else {
+            const size_t col_middle = col_begin + num_col_blocks / 2 * 8;
+            _transpose_bit_tiles(matrix, row_begin, row_end, col_begin, col_middle);
+            _transpose_bit_tiles(matrix, row_begin, row_end, col_middle, col_end);
+        }
+    }
+
+    void _mirror_bits_generic(uint8_t * buf, size_t size)
+    {
+        uint8_t * first = buf;
+        uint8_t * last = buf + size;
+
+        while (last - first >= 16) {
+            uint64_t first_value;
+            uint64_t last_value;
+            memcpy(&first_value, first, 8);
+            memcpy(&last_value, last - 8, 8);
+
+            first_value = _reverse_bits64(first_value);
+            last_value = _reverse_bits64(last_value);
+
+            memcpy(first, &last_value, 8);
+            memcpy(last - 8, &first_value, 8);
+
+            first += 8;
+            last -= 8;
+        }
+
+        while (first < last) {
+            const uint8_t first_byte = utility::reverse(*first);
+            *first++ = utility::reverse(*--last);
+            *last = first_byte;
+        }
+    }
+
+    // Nibble lookup tables for the `pshufb`:
+    //  reversed bits of a nibble and reversed bits of a nibble shifted to the high nibble
+    //
+#define MIRROR_NIBBLE_TABLE_BYTES \
+    0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F
+#define MIRROR_HIGH_NIBBLE_TABLE_BYTES \
+    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0
+#define MIRROR_BYTES_SHUFFLE_BYTES \
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+
+    // reverses bits in each byte and then bytes in each 128-bit lane
+    UTILITY_TARGET("ssse3")
+    FORCE_INLINE __m128i _mirror_bits_128(__m128i value, __m128i nibble_table, __m128i high_nibble_table, __m128i bytes_shuffle, __m128i nibble_mask)
+    {
+        value = _mm_shuffle_epi8(value, bytes_shuffle);
+        const __m128i low_nibbles = _mm_and_si128(value, nibble_mask);
+        const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(value, 4), nibble_mask);
+        return _mm_or_si128(_mm_shuffle_epi8(high_nibble_table, low_nibbles), _mm_shuffle_epi8(nibble_table, high_nibbles));
+    }
+
+    UTILITY_TARGET("ssse3")
+    void _mirror_bits_ssse3(uint8_t * buf, size_t size)
+    {
+        const __m128i nibble_table = _mm_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES);
+        const __m128i high_nibble_table = _mm_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m128i bytes_shuffle = _mm_setr_epi8(MIRROR_BYTES_SHUFFLE_BYTES);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+        uint8_t * first = buf;
+        uint8_t * last = buf + size;
+
+        while (last - first >= 32) {
+            const __m128i first_value = _mm_loadu_si128((const __m128i *)first);
+            const __m128i last_value = _mm_loadu_si128((const __m128i *)(last - 16));
+
+            _mm_storeu_si128((__m128i *)first, _mirror_bits_128(last_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            _mm_storeu_si128((__m128i *)(last - 16), _mirror_bits_128(first_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+
+            first += 16;
+            last -= 16;
+        }
+
+        _mirror_bits_generic(first, size_t(last - first));
+    }
+
+    UTILITY_TARGET("avx2")
+    FORCE_INLINE __m256i _mirror_bits_256(__m256i value, __m256i nibble_table, __m256i high_nibble_table, __m256i bytes_shuffle, __m256i nibble_mask)
+    {
+        value = _mm256_shuffle_epi8(value, bytes_shuffle);
+        value = _mm256_permute4x64_epi64(value, 0x4E); // swap 128-bit lanes
+        const __m256i low_nibbles = _mm256_and_si256(value, nibble_mask);
+        const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(value, 4), nibble_mask);
+        return _mm256_or_si256(_mm256_shuffle_epi8(high_nibble_table, low_nibbles), _mm256_shuffle_epi8(nibble_table, high_nibbles));
+    }
+
+    UTILITY_TARGET("avx2")
+    void _mirror_bits_avx2(uint8_t * buf, size_t size)
+    {
+        const __m256i nibble_table = _mm256_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES, MIRROR_NIBBLE_TABLE_BYTES);
+        const __m256i high_nibble_table = _mm256_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES, MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m256i bytes_shuffle = _mm256_setr_epi8(MIRROR_BYTES_SHUFFLE_BYTES, MIRROR_BYTES_SHUFFLE_BYTES);
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+        uint8_t * first = buf;
+        uint8_t * last = buf + size;
+
+        while (last - first >= 64) {
+            const __m256i first_value = _mm256_loadu_si256((const __m256i *)first);
+            const __m256i last_value = _mm256_loadu_si256((const __m256i *)(last - 32));
+
+            _mm256_storeu_si256((__m256i *)first, _mirror_bits_256(last_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            _mm256_storeu_si256((__m256i *)(last - 32), _mirror_bits_256(first_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+
+            first += 32;
+            last -= 32;
+        }
+
+        _mirror_bits_ssse3(first, size_t(last - first));
+    }
+
+    UTILITY_TARGET("avx512f,avx512bw")
+    FORCE_INLINE __m512i _mirror_bits_512(__m512i value, __m512i nibble_table, __m512i high_nibble_table, __m512i bytes_shuffle, __m512i nibble_mask)
+    {
+        value = _mm512_shuffle_epi8(value, bytes_shuffle);
+        value = _mm512_shuffle_i64x2(value, value, 0x1B); // reverse 128-bit lanes
+        const __m512i low_nibbles = _mm512_and_si512(value, nibble_mask);
+        const __m512i high_nibbles = _mm512_and_si512(_mm512_srli_epi16(value, 4), nibble_mask);
+        return _mm512_or_si512(_mm512_shuffle_epi8(high_nibble_table, low_nibbles), _mm512_shuffle_epi8(nibble_table, high_nibbles));
+    }
+
+    UTILITY_TARGET("avx512f,avx512bw")
+    void _mirror_bits_avx512(uint8_t * buf, size_t size)
+    {
+        const __m512i nibble_table = _mm512_broadcast_i32x4(_mm_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES));
+        const __m512i high_nibble_table = _mm512_broadcast_i32x4(_mm_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES));
+        const __m512i bytes_shuffle = _mm512_broadcast_i32x4(_mm_setr_epi8(MIRROR_BYTES_SHUFFLE_BYTES));
+        const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+
+        uint8_t * first = buf;
+        uint8_t * last = buf + size;
+
+        while (last - first >= 128) {
+            const __m512i first_value = _mm512_loadu_si512((const void *)first);
+            const __m512i last_value = _mm512_loadu_si512((const void *)(last - 64));
+
+            _mm512_storeu_si512((void *)first, _mirror_bits_512(last_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            _mm512_storeu_si512((void *)(last - 64), _mirror_bits_512(first_value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+
+            first += 64;
+            last -= 64;
+        }
+
+        _mirror_bits_avx2(first, size_t(last - first));
+    }
+
+    // `pshufb` masks to reverse bytes in each 2/4/8/16 bytes word of a 128-bit lane
+    const uint8_t s_swap_bytes_shuffles[4][16] = {
+        { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 },
+        { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 },
+        { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 },
+        { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }
+    };
+
+    FORCE_INLINE const uint8_t * _get_swap_bytes_shuffle(size_t word_size)
+    {
+        switch (word_size) {
+        case 2: return s_swap_bytes_shuffles[0];
+        case 4: return s_swap_bytes_shuffles[1];
+        case 8: return s_swap_bytes_shuffles[2];
+        case 16: return s_swap_bytes_shuffles[3];
+        }
+
+        return nullptr;
+    }
+
+    // scalar rows of 1, 2, 4 and 8 bytes are reversed in a register
+    template <typename T>
+    void _mirror_rows_scalar_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        for (size_t i = 0; i < num_rows; i++, buf += stride) {
+            T value;
+            memcpy(&value, buf, sizeof(T));
+            value = T(_reverse_bits64(uint64_t(value)) >> (64 - sizeof(T) * CHAR_BIT));
+            memcpy(buf, &value, sizeof(T));
+        }
+    }
+
+    template <size_t N>
+    void _mirror_rows_generic_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        for (size_t i = 0; i < num_rows; i++, buf += stride) {
+            _mirror_bits_generic(buf, N);
+        }
+    }
+
+    void _mirror_rows_generic(uint8_t * buf, size_t num_rows, size_t row_size, size_t stride)
+    {
+        for (size_t i = 0; i < num_rows; i++, buf += stride) {
+            utility::mirror_bits(buf, row_size);
+        }
+    }
+
+    // packed rows of 2, 4, 8 and 16 bytes are mirrored by 16 bytes with the shuffle of bytes in each row
+    template <size_t N>
+    UTILITY_TARGET("ssse3")
+    void _mirror_rows_ssse3_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        const __m128i nibble_table = _mm_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES);
+        const __m128i high_nibble_table = _mm_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m128i bytes_shuffle = _mm_loadu_si128((const __m128i *)_get_swap_bytes_shuffle(N));
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+        size_t i = 0;
+
+        if (stride == N) {
+            const size_t size = num_rows * N;
+            for (; i + 16 <= size; i += 16) {
+                const __m128i value = _mm_loadu_si128((const __m128i *)(buf + i));
+                _mm_storeu_si128((__m128i *)(buf + i), _mirror_bits_128(value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            }
+            i /= N;
+        }
+        else if (N == 16) {
+            for (; i < num_rows; i++) {
+                uint8_t * row = buf + i * stride;
+                const __m128i value = _mm_loadu_si128((const __m128i *)row);
+                _mm_storeu_si128((__m128i *)row, _mirror_bits_128(value, nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            }
+        }
+
+        if (i < num_rows) {
+            switch (N) {
+            case 2: _mirror_rows_scalar_t<uint16_t>(buf + i * stride, num_rows - i, N, stride); break;
+            case 4: _mirror_rows_scalar_t<uint32_t>(buf + i * stride, num_rows - i, N, stride); break;
+            case 8: _mirror_rows_scalar_t<uint64_t>(buf + i * stride, num_rows - i, N, stride); break;
+            }
+        }
+    }
+
+    // rows of 32 and 64 bytes are mirrored by the swapped register size parts
+    template <size_t N>
+    UTILITY_TARGET("ssse3")
+    void _mirror_wide_rows_ssse3_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        const __m128i nibble_table = _mm_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES);
+        const __m128i high_nibble_table = _mm_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m128i bytes_shuffle = _mm_setr_epi8(MIRROR_BYTES_SHUFFLE_BYTES);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+        for (size_t i = 0; i < num_rows; i++, buf += stride) {
+            __m128i values[N / 16];
+            for (size_t j = 0; j < N / 16; j++) {
+                values[j] = _mm_loadu_si128((const __m128i *)(buf + j * 16));
+            }
+            for (size_t j = 0; j < N / 16; j++) {
+                _mm_storeu_si128((__m128i *)(buf + N - (j + 1) * 16), _mirror_bits_128(values[j], nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            }
+        }
+    }
+
+    template <size_t N>
+    UTILITY_TARGET("avx2")
+    void _mirror_rows_avx2_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        const __m256i nibble_table = _mm256_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES, MIRROR_NIBBLE_TABLE_BYTES);
+        const __m256i high_nibble_table = _mm256_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES, MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+        if (stride != N) {
+            _mirror_rows_ssse3_t<N>(buf, num_rows, N, stride);
+            return;
+        }
+
+        // packed rows do not cross 128-bit lanes, so there is no lanes swap
+        const __m256i bytes_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)_get_swap_bytes_shuffle(N)));
+
+        const size_t size = num_rows * N;
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            const __m256i value = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(buf + i)), bytes_shuffle);
+            const __m256i low_nibbles = _mm256_and_si256(value, nibble_mask);
+            const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(value, 4), nibble_mask);
+            _mm256_storeu_si256((__m256i *)(buf + i),
+                _mm256_or_si256(_mm256_shuffle_epi8(high_nibble_table, low_nibbles), _mm256_shuffle_epi8(nibble_table, high_nibbles)));
+        }
+
+        _mirror_rows_ssse3_t<N>(buf + i, num_rows - i / N, N, stride);
+    }
+
+    template <size_t N>
+    UTILITY_TARGET("avx2")
+    void _mirror_wide_rows_avx2_t(uint8_t * buf, size_t num_rows, size_t /*row_size*/, size_t stride)
+    {
+        const __m256i nibble_table = _mm256_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES, MIRROR_NIBBLE_TABLE_BYTES);
+        const __m256i high_nibble_table = _mm256_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES, MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+        const __m256i bytes_shuffle = _mm256_setr_epi8(MIRROR_BYTES_SHUFFLE_BYTES, MIRROR_BYTES_SHUFFLE_BYTES);
+
+        for (size_t i = 0; i < num_rows; i++, buf += stride) {
+            __m256i values[N / 32];
+            for (size_t j = 0; j < N / 32; j++) {
+                values[j] = _mm256_loadu_si256((const __m256i *)(buf + j * 32));
+            }
+            for (size_t j = 0; j < N / 32; j++) {
+                _mm256_storeu_si256((__m256i *)(buf + N - (j + 1) * 32), _mirror_bits_256(values[j], nibble_table, high_nibble_table, bytes_shuffle, nibble_mask));
+            }
+        }
+    }
+
+    template <typename T, T (* Swap)(T)>
+    FORCE_INLINE void _swap_words(uint8_t * buf, size_t size)
+    {
+        for (size_t i = 0; i < size; i += sizeof(T)) {
+            T value;
+            memcpy(&value, buf + i, sizeof(T));
+            value = Swap(value);
+            memcpy(buf + i, &value, sizeof(T));
+        }
+    }
+
+    void _swap_bytes_generic(uint8_t * buf, size_t size, size_t word_size)
+    {
+        switch (word_size) {
+        case 1:
+            break;
+        case 2:
+            _swap_words<uint16_t, _byteswap16>(buf, size);
+            break;
+        case 4:
+            _swap_words<uint32_t, _byteswap32>(buf, size);
+            break;
+        case 8:
+            _swap_words<uint64_t, _byteswap64>(buf, size);
+            break;
+        case 16:
+            for (size_t i = 0; i < size; i += 16) {
+                uint64_t values[2];
+                memcpy(values, buf + i, 16);
+                const uint64_t first_value = _byteswap64(values[1]);
+                values[1] = _byteswap64(values[0]);
+                values[0] = first_value;
+                memcpy(buf + i, values, 16);
+            }
+            break;
+        default:
+            for (size_t i = 0; i < size; i += word_size) {
+                std::reverse(buf + i, buf + i + word_size);
+            }
+        }
+    }
+
+    UTILITY_TARGET("ssse3")
+    void _swap_bytes_ssse3(uint8_t * buf, size_t size, size_t word_size)
+    {
+        const uint8_t * shuffle_bytes = _get_swap_bytes_shuffle(word_size);
+        if (!shuffle_bytes) {
+            _swap_bytes_generic(buf, size, word_size);
+            return;
+        }
+
+        const __m128i bytes_shuffle = _mm_loadu_si128((const __m128i *)shuffle_bytes);
+
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            _mm_storeu_si128((__m128i *)(buf + i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buf + i)), bytes_shuffle));
+        }
+
+        _swap_bytes_generic(buf + i, size - i, word_size);
+    }
+
+    UTILITY_TARGET("avx2")
+    void _swap_bytes_avx2(uint8_t * buf, size_t size, size_t word_size)
+    {
+        const uint8_t * shuffle_bytes = _get_swap_bytes_shuffle(word_size);
+        if (!shuffle_bytes) {
+            _swap_bytes_generic(buf, size, word_size);
+            return;
+        }
+
+        const __m256i bytes_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)shuffle_bytes));
+
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64) {
+            const __m256i value0 = _mm256_loadu_si256((const __m256i *)(buf + i));
+            const __m256i value1 = _mm256_loadu_si256((const __m256i *)(buf + i + 32));
+            _mm256_storeu_si256((__m256i *)(buf + i), _mm256_shuffle_epi8(value0, bytes_shuffle));
+            _mm256_storeu_si256((__m256i *)(buf + i + 32), _mm256_shuffle_epi8(value1, bytes_shuffle));
+        }
+
+        _swap_bytes_ssse3(buf + i, size - i, word_size);
+    }
+
+    void _reverse_bits_in_bytes_generic(uint8_t * buf, size_t size)
+    {
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t value;
+            memcpy(&value, buf + i, 8);
+            value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >> 4) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+            value = ((value & 0xCCCCCCCCCCCCCCCCULL) >> 2) | ((value & 0x3333333333333333ULL) << 2);
+            value = ((value & 0xAAAAAAAAAAAAAAAAULL) >> 1) | ((value & 0x5555555555555555ULL) << 1);
+            memcpy(buf + i, &value, 8);
+        }
+
+        for (; i < size; i++) {
+            buf[i] = utility::reverse(buf[i]);
+        }
+    }
+
+    UTILITY_TARGET("ssse3")
+    void _reverse_bits_in_bytes_ssse3(uint8_t * buf, size_t size)
+    {
+        const __m128i nibble_table = _mm_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES);
+        const __m128i high_nibble_table = _mm_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+            const __m128i value = _mm_loadu_si128((const __m128i *)(buf + i));
+            const __m128i low_nibbles = _mm_and_si128(value, nibble_mask);
+            const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(value, 4), nibble_mask);
+            _mm_storeu_si128((__m128i *)(buf + i),
+                _mm_or_si128(_mm_shuffle_epi8(high_nibble_table, low_nibbles), _mm_shuffle_epi8(nibble_table, high_nibbles)));
+        }
+
+        _reverse_bits_in_bytes_generic(buf + i, size - i);
+    }
+
+    UTILITY_TARGET("avx2")
+    void _reverse_bits_in_bytes_avx2(uint8_t * buf, size_t size)
+    {
+        const __m256i nibble_table = _mm256_setr_epi8(MIRROR_NIBBLE_TABLE_BYTES, MIRROR_NIBBLE_TABLE_BYTES);
+        const __m256i high_nibble_table = _mm256_setr_epi8(MIRROR_HIGH_NIBBLE_TABLE_BYTES, MIRROR_HIGH_NIBBLE_TABLE_BYTES);
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            const __m256i value = _mm256_loadu_si256((const __m256i *)(buf + i));
+            const __m256i low_nibbles = _mm256_and_si256(value, nibble_mask);
+            const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(value, 4), nibble_mask);
+            _mm256_storeu_si256((__m256i *)(buf + i),
+                _mm256_or_si256(_mm256_shuffle_epi8(high_nibble_table, low_nibbles), _mm256_shuffle_epi8(nibble_table, high_nibbles)));
+        }
+
+        _reverse_bits_in_bytes_ssse3(buf + i, size - i);
+    }
+
+    void _permute_bytes_generic(uint8_t * buf, size_t size, const utility::BytePermutation & permutation)
+    {
+        const size_t word_size = permutation.word_size;
+        const uint8_t * indexes = &permutation.indexes[0];
+
+        std::vector<uint8_t> word(word_size);
+
+        for (size_t i = 0; i < size; i += word_size) {
+            memcpy(&word[0], buf + i, word_size);
+            for (size_t j = 0; j < word_size; j++) {
+                buf[i + j] = word[indexes[j]];
+            }
+        }
+    }
+
+    UTILITY_TARGET("ssse3")
+    void _permute_bytes_ssse3(uint8_t * buf, size_t size, const utility::BytePermutation & permutation)
+    {
+        if (!permutation.period_size) {
+            _permute_bytes_generic(buf, size, permutation);
+            return;
+        }
+
+        size_t i = 0;
+
+        if (permutation.period_size == 16) {
+            // the word size divides 16 bytes, a single shuffle per 16 bytes
+            const __m128i bytes_shuffle = _mm_loadu_si128((const __m128i *)&permutation.shuffles[0]);
+
+            for (; i + 16 <= size; i += 16) {
+                _mm_storeu_si128((__m128i *)(buf + i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buf + i)), bytes_shuffle));
+            }
+        }
+        else {
+            // words cross the 16 bytes boundary, each 16 bytes of the period is merged from 3 shuffles of the neighbour
+            // 16 bytes, the period begins at a word boundary, so a period is loaded at once and permuted in place
+            const size_t num_values = permutation.period_size / 16;
+            const __m128i * bytes_shuffles = (const __m128i *)&permutation.shuffles[0];
+
+            __m128i values[16 + 2];
+            values[0] = _mm_setzero_si128();
+            values[num_values + 1] = _mm_setzero_si128();
+
+            for (; i + permutation.period_size <= size; i += permutation.period_size) {
+                for (size_t j = 0; j < num_values; j++) {
+                    values[j + 1] = _mm_loadu_si128((const __m128i *)(buf + i + j * 16));
+                }
+
+                for (size_t j = 0; j < num_values; j++) {
+                    const __m128i value = _mm_or_si128(_mm_or_si128(
+                        _mm_shuffle_epi8(values[j], _mm_loadu_si128(bytes_shuffles + j * 3)),
+                        _mm_shuffle_epi8(values[j + 1], _mm_loadu_si128(bytes_shuffles + j * 3 + 1))),
+                        _mm_shuffle_epi8(values[j + 2], _mm_loadu_si128(bytes_shuffles + j * 3 + 2)));
+                    _mm_storeu_si128((__m128i *)(buf + i + j * 16), value);
+                }
+            }
+        }
+
+        _permute_bytes_generic(buf + i, size - i, permutation);
+    }
+
+    UTILITY_TARGET("avx2")
+    void _permute_bytes_avx2(uint8_t * buf, size_t size, const utility::BytePermutation & permutation)
+    {
+        if (permutation.period_size != 16) {
+            _permute_bytes_ssse3(buf, size, permutation);
+            return;
+        }
+
+        const __m256i bytes_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&permutation.shuffles[0]));
+
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64) {
+            const __m256i value0 = _mm256_loadu_si256((const __m256i *)(buf + i));
+            const __m256i value1 = _mm256_loadu_si256((const __m256i *)(buf + i + 32));
+            _mm256_storeu_si256((__m256i *)(buf + i), _mm256_shuffle_epi8(value0, bytes_shuffle));
+            _mm256_storeu_si256((__m256i *)(buf + i + 32), _mm256_shuffle_epi8(value1, bytes_shuffle));
+        }
+
+        _permute_bytes_ssse3(buf + i, size - i, permutation);
+    }
+
+    PermuteBytesFunc _select_permute_bytes_func()
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+
+        if (cpu_features.avx2) {
+            return _permute_bytes_avx2;
+        }
+        if (cpu_features.ssse3) {
+            return _permute_bytes_ssse3;
+        }
+
+        return _permute_bytes_generic;
+    }
+
+    template <typename T>
+    void _permute_bits_t(uint8_t * buf, size_t size, const uint64_t * tables)
+    {
+        for (size_t i = 0; i < size; i += sizeof(T)) {
+            T value;
+            memcpy(&value, buf + i, sizeof(T));
+
+            T permuted_value = 0;
+            for (size_t j = 0; j < sizeof(T); j++) {
+                permuted_value |= T(tables[j * 256 + uint8_t(value >> (j * CHAR_BIT))]);
+            }
+
+            memcpy(buf + i, &permuted_value, sizeof(T));
+        }
+    }
+
+    SwapBytesFunc _select_swap_bytes_func()
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+
+        if (cpu_features.avx2) {
+            return _swap_bytes_avx2;
+        }
+        if (cpu_features.ssse3) {
+            return _swap_bytes_ssse3;
+        }
+
+        return _swap_bytes_generic;
+    }
+
+    ReverseBitsInBytesFunc _select_reverse_bits_in_bytes_func()
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+
+        if (cpu_features.avx2) {
+            return _reverse_bits_in_bytes_avx2;
+        }
+        if (cpu_features.ssse3) {
+            return _reverse_bits_in_bytes_ssse3;
+        }
+
+        return _reverse_bits_in_bytes_generic;
+    }
+
+    utility::MirrorRowsFunc _select_mirror_rows_func(size_t row_size)
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+
+        switch (row_size) {
+        case 1:
+            return _mirror_rows_scalar_t<uint8_t>;
+        case 2:
+            return cpu_features.avx2 ? _mirror_rows_avx2_t<2> : cpu_features.ssse3 ? _mirror_rows_ssse3_t<2> : _mirror_rows_scalar_t<uint16_t>;
+        case 4:
+            return cpu_features.avx2 ? _mirror_rows_avx2_t<4> : cpu_features.ssse3 ? _mirror_rows_ssse3_t<4> : _mirror_rows_scalar_t<uint32_t>;
+        case 8:
+            return cpu_features.avx2 ? _mirror_rows_avx2_t<8> : cpu_features.ssse3 ? _mirror_rows_ssse3_t<8> : _mirror_rows_scalar_t<uint64_t>;
+        case 16:
+            return cpu_features.avx2 ? _mirror_rows_avx2_t<16> : cpu_features.ssse3 ? _mirror_rows_ssse3_t<16> : _mirror_rows_generic_t<16>;
+        case 32:
+            return cpu_features.avx2 ? _mirror_wide_rows_avx2_t<32> : cpu_features.ssse3 ? _mirror_wide_rows_ssse3_t<32> : _mirror_rows_generic_t<32>;
+        case 64:
+            return cpu_features.avx2 ? _mirror_wide_rows_avx2_t<64> : cpu_features.ssse3 ? _mirror_wide_rows_ssse3_t<64> : _mirror_rows_generic_t<64>;
+        }
+
+        return _mirror_rows_generic;
+    }
+
+    MirrorBitsFunc _select_mirror_bits_func()
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+
+        if (cpu_features.avx512bw) {
+            return _mirror_bits_avx512;
+        }
+        if (cpu_features.avx2) {
+            return _mirror_bits_avx2;
+        }
+        if (cpu_features.ssse3) {
+            return _mirror_bits_ssse3;
+        }
+
+        return _mirror_bits_generic;
+    }
+}
+
+namespace utility
+{
+    void mirror_bits(uint8_t * buf, size_t size)
+    {
+        static const MirrorBitsFunc s_mirror_bits_func = _select_mirror_bits_func();
+
+        ASSERT_TRUE(buf || !size);
+
+        s_mirror_bits_func(buf, size);
+    }
+
+    MirrorRowsFunc get_mirror_rows_func(size_t row_size)
+    {
+        ASSERT_TRUE(row_size);
+
+        return _select_mirror_rows_func(row_size);
+    }
+
+    void swap_bytes(uint8_t * buf, size_t size, size_t word_size)
+    {
+        static const SwapBytesFunc s_swap_bytes_func = _select_swap_bytes_func();
+
+        ASSERT_TRUE((buf || !size) && word_size);
+        ASSERT_EQ(0, size % word_size);
+
+        s_swap_bytes_func(buf, size, word_size);
+    }
+
+    void reverse_bits_in_bytes(uint8_t * buf, size_t size)
+    {
+        static const ReverseBitsInBytesFunc s_reverse_bits_in_bytes_func = _select_reverse_bits_in_bytes_func();
+
+        ASSERT_TRUE(buf || !size);
+
+        s_reverse_bits_in_bytes_func(buf, size);
+    }
+
+    BytePermutation compile_byte_permutation(const std::vector<uint8_t> & indexes)
+    {
+        const size_t word_size = indexes.size();
+
+        for (auto index : indexes) {
+            if (index >= word_size) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": byte index is out of word: index=%u word_size=%u")) %
+                            uint32_t(index) % word_size).str());
+            }
+        }
+
+        std::vector<bool> used(word_size);
+
+        for (auto index : indexes) {
+            if (used[index]) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": byte index is repeated: index=%u")) %
+                            uint32_t(index)).str());
+            }
+            used[index] = true;
+        }
+
+        BytePermutation permutation;
+
+        permutation.word_size = word_size;
+        permutation.indexes = indexes;
+        permutation.period_size = 0;
+
+        if (!word_size || word_size > 16) {
+            return permutation;
+        }
+
+        if (!(16 % word_size)) {
+            permutation.period_size = 16;
+            permutation.shuffles.resize(16);
+            for (size_t i = 0; i < 16; i++) {
+                permutation.shuffles[i] = uint8_t(i / word_size * word_size + indexes[i % word_size]);
+            }
+            return permutation;
+        }
+
+        size_t period_size = word_size;
+        while (period_size % 16) {
+            period_size += word_size;
+        }
+
+        permutation.period_size = period_size;
+
+        // the `pshufb` zeroes a byte by the high bit of the index
+        permutation.shuffles.assign(period_size / 16 * 3 * 16, 0x80);
+
+        for (size_t i = 0; i < period_size; i++) {
+            const size_t in_offset = i / word_size * word_size + indexes[i % word_size];
+            const size_t value_index = i / 16;
+            const size_t in_value_index = in_offset / 16; // previous, current or next 16 bytes
+            permutation.shuffles[(value_index * 3 + in_value_index + 1 - value_index) * 16 + i % 16] = uint8_t(in_offset % 16);
+        }
+
+        return permutation;
+    }
+
+    void permute_bytes(uint8_t * buf, size_t size, const BytePermutation & permutation)
+    {
+        static const PermuteBytesFunc s_permute_bytes_func = _select_permute_bytes_func();
+
+        ASSERT_TRUE((buf || !size) && permutation.word_size);
+        ASSERT_EQ(0, size % permutation.word_size);
+
+        s_permute_bytes_func(buf, size, permutation);
+    }
+
+    BitPermutation compile_bit_permutation(const std::vector<uint8_t> & indexes)
+    {
+        const size_t bit_size = indexes.size();
+
+        if (bit_size != 8 && bit_size != 16 && bit_size != 32 && bit_size != 64) {
+            throw std::runtime_error(
+                (boost::format(
+                    BOOST_PP_CAT(__FUNCTION__, ": word bit size is not supported: bit_size=%u")) %
+                        bit_size).str());
+        }
+
+        for (auto index : indexes) {
+            if (index >= bit_size) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": bit index is out of word: index=%u bit_size=%u")) %
+                            uint32_t(index) % bit_size).str());
+            }
+        }
+
+        std::vector<bool> used(bit_size);
+
+        for (auto index : indexes) {
+            if (used[index]) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": bit index is repeated: index=%u")) %
+                            uint32_t(index)).str());
+            }
+            used[index] = true;
+        }
+
+        BitPermutation permutation;
+
+        permutation.word_size = bit_size / CHAR_BIT;
+        permutation.indexes = indexes;
+        permutation.tables.assign(permutation.word_size * 256, 0);
+
+        for (size_t i = 0; i < bit_size; i++) {
+            const size_t in_byte_index = indexes[i] / CHAR_BIT;
+            const uint32_t in_bit_mask = 1U << (indexes[i] % CHAR_BIT);
+
+            uint64_t * table = &permutation.tables[in_byte_index * 256];
+            for (uint32_t j = 0; j < 256; j++) {
+                if (j & in_bit_mask) {
+                    table[j] |= uint64_t(1) << i;
+                }
+            }
+        }
+
+        return permutation;
+    }
+
+    void permute_bits(uint8_t * buf, size_t size, const BitPermutation & permutation)
+    {
+        ASSERT_TRUE((buf || !size) && permutation.word_size);
+        ASSERT_EQ(0, size % permutation.word_size);
+
+        const uint64_t * tables = &permutation.tables[0];
+
+        switch (permutation.word_size) {
+        case 1:
+            _permute_bits_t<uint8_t>(buf, size, tables);
+            break;
+        case 2:
+            _permute_bits_t<uint16_t>(buf, size, tables);
+            break;
+        case 4:
+            _permute_bits_t<uint32_t>(buf, size, tables);
+            break;
+        case 8:
+            _permute_bits_t<uint64_t>(buf, size, tables);
+            break;
+        default:
+            ASSERT_TRUE(false);
+        }
+    }
+
+    void mirror_bit_range(const uint8_t * in_buf, size_t in_size, uint64_t in_bit_offset, uint8_t * out_buf, uint64_t out_bit_offset, size_t bit_size)
+    {
+        ASSERT_TRUE(in_buf && out_buf);
+        ASSERT_GE(uint64_t(in_size) * CHAR_BIT, in_bit_offset + bit_size);
+
+        _mirror_bit_range(in_buf, in_size, in_bit_offset, out_buf, out_bit_offset, bit_size);
+    }
+
+    void mirror_bit_rows(const uint8_t * in_buf, size_t in_size, uint8_t * out_buf, size_t num_rows, size_t bit_width)
+    {
+        ASSERT_TRUE(in_buf && out_buf && bit_width);
+        ASSERT_GE(uint64_t(in_size) * CHAR_BIT, uint64_t(num_rows) * bit_width);
+
+        uint64_t bit_offset = 0;
+        for (size_t i = 0; i < num_rows; i++, bit_offset += bit_width) {
+            _mirror_bit_range(in_buf, in_size, bit_offset, out_buf, bit_offset, bit_width);
+        }
+    }
+
+    uint64_t transpose_bits8x8(uint64_t value)
+    {
+        return _transpose_bits8x8(value);
+    }
+
+    void transpose_bits64x64(uint64_t * rows)
+    {
+        ASSERT_TRUE(rows);
+
+        _transpose_bits64x64(rows);
+    }
+
+    void transpose_bit_matrix(const uint8_t * in_buf, size_t num_rows, size_t row_size, uint8_t * out_buf, size_t out_stride)
+    {
+        ASSERT_TRUE(in_buf && out_buf && row_size);
+        ASSERT_EQ(0, num_rows % CHAR_BIT);
+        ASSERT_GE(out_stride, num_rows / CHAR_BIT);
+
+        const TransposeBitMatrix matrix = { in_buf, row_size, out_buf, out_stride };
+
+        const size_t num_block_rows = num_rows / 64 * 64;
+        if (num_block_rows) {
+            _transpose_bit_tiles(matrix, 0, num_block_rows, 0, row_size);
+        }
+
+        // rows out of the 64 rows blocks
+        for (size_t row = num_block_rows; row < num_rows; row += CHAR_BIT) {
+            for (size_t col = 0; col < row_size; col++) {
+                const uint8_t * in_buf_ = in_buf + row * row_size + col;
+
+                uint64_t value = 0;
+                for (size_t i = 0; i < CHAR_BIT; i++, in_buf_ += row_size) {
+                    value = (value << CHAR_BIT) | *in_buf_;
+                }
+
+                value = _transpose_bits8x8(value);
+
+                uint8_t * out_buf_ = out_buf + col * CHAR_BIT * out_stride + row / CHAR_BIT;
+                for (size_t i = 0; i < CHAR_BIT; i++, out_buf_ += out_stride) {
+                    *out_buf_ = uint8_t(value >> (56 - i * CHAR_BIT));
+                }
+            }
+        }
+    }
+}
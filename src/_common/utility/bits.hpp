@@ -0,0 +1,83 @@
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+
+#include <vector>
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace utility
+{
+    // Byte permutation of a word compiled into the `pshufb` masks.
+    struct BytePermutation
+    {
+        size_t word_size;
+        std::vector<uint8_t> indexes;   // output byte `i` of a word is the input byte `indexes[i]` of the word
+        size_t period_size;             // least common multiple of the word and 16 bytes, 0 if the word is longer than 16 bytes
+        std::vector<uint8_t> shuffles;  // 16 bytes masks: 1 per 16 bytes if the word size divides 16 bytes, otherwise 3 per 16 bytes
+                                        // of the period to select bytes from the previous, the current and the next 16 bytes
+    };
+
+    BytePermutation compile_byte_permutation(const std::vector<uint8_t> & indexes);
+
+    // Permutes bytes in place in each word, the size must be a multiple of the word size.
+    void permute_bytes(uint8_t * buf, size_t size, const BytePermutation & permutation);
+
+    // Bit permutation of a 8/16/32/64-bit little endian word compiled into the lookup tables of the permuted bits of
+    // each input byte, the word is permuted by the composition of a lookup per byte.
+    struct BitPermutation
+    {
+        size_t word_size;               // in bytes
+        std::vector<uint8_t> indexes;   // output bit `i` of a word is the input bit `indexes[i]`, the bit 0 is the least significant
+        std::vector<uint64_t> tables;   // 256 entries per input byte of a word
+    };
+
+    BitPermutation compile_bit_permutation(const std::vector<uint8_t> & indexes);
+
+    // Permutes bits in place in each word, the size must be a multiple of the word size.
+    void permute_bits(uint8_t * buf, size_t size, const BitPermutation & permutation);
+
+    // Reverses the buffer bit by bit in place: the byte order is reversed and the bits in each byte are reversed, so the
+    // last bit becomes the first. The implementation (generic/SSSE3/AVX2/AVX-512) is selected once by the cpu features.
+    void mirror_bits(uint8_t * buf, size_t size);
+
+    // Mirrors (reverses bytes and bits in bytes) in place `num_rows` rows of `row_size` bytes at the `stride` bytes pitch.
+    typedef void (* MirrorRowsFunc)(uint8_t * buf, size_t num_rows, size_t row_size, size_t stride);
+
+    // Returns the mirror rows kernel specialized at compile time for the 1, 2, 4, 8, 16, 32 and 64 bytes rows, where a
+    // row fits one or a few registers, with the implementation selected by the cpu features. Other row sizes have the
+    // generic kernel over `mirror_bits`. Intended to be called once per run.
+    MirrorRowsFunc get_mirror_rows_func(size_t row_size);
+
+    // Reverses the byte order in each word of `word_size` bytes without the bits reverse, the size must be a multiple of
+    // the word size. Words of 2, 4, 8 and 16 bytes are swapped by bswap/pshufb kernels selected once by the cpu features.
+    void swap_bytes(uint8_t * buf, size_t size, size_t word_size);
+
+    // Reverses the bits in each byte in place without the byte order change.
+    void reverse_bits_in_bytes(uint8_t * buf, size_t size);
+
+    // Reverses `bit_size` bits of the input buffer from `in_bit_offset` into the output buffer at `out_bit_offset`.
+    // The bits are packed from the most significant bit of each byte. The output bits must be zeroed and the output
+    // buffer must have at least 8 spare bytes after the last written bit, the input buffer is read within `in_size`.
+    void mirror_bit_range(const uint8_t * in_buf, size_t in_size, uint64_t in_bit_offset, uint8_t * out_buf, uint64_t out_bit_offset, size_t bit_size);
+
+    // Reverses `num_rows` rows of `bit_width` bits packed back to back, with the same requirements.
+    void mirror_bit_rows(const uint8_t * in_buf, size_t in_size, uint8_t * out_buf, size_t num_rows, size_t bit_width);
+
+    // Transposes the 8x8 bit matrix of 8 rows of a byte, the first row is the most significant byte of the value and
+    // the first column is the most significant bit of a byte.
+    uint64_t transpose_bits8x8(uint64_t value);
+
+    // Transposes in place the 64x64 bit matrix of 64 rows, the first column is the most significant bit of a row.
+    void transpose_bits64x64(uint64_t * rows);
+
+    // Transposes the bit matrix of `num_rows` (a multiple of 8) rows of `row_size` bytes, the first column is the most
+    // significant bit of the first byte of a row. The bit column `i` is written as `num_rows / 8` bytes at
+    // `out_buf + i * out_stride`. The matrix is split recursively down to the 64x64 blocks (cache oblivious), rows out
+    // of the 64 rows blocks are transposed by the 8x8 blocks.
+    void transpose_bit_matrix(const uint8_t * in_buf, size_t num_rows, size_t row_size, uint8_t * out_buf, size_t out_stride);
+}
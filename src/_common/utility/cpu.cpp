@@ -0,0 +1,90 @@
+#include <utility/cpu.hpp>
+
+#ifdef UTILITY_COMPILER_CXX_MSC
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#include <cstdint>
+
+
+namespace
+{
+    void _cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (& regs)[4])
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        int regs_[4];
+        __cpuidex(regs_, int(leaf), int(subleaf));
+        for (size_t i = 0; i < 4; i++) {
+            regs[i] = uint32_t(regs_[i]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    uint64_t _xgetbv0()
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (uint64_t(edx) << 32) | eax;
+#endif
+    }
+
+    utility::CpuFeatures _detect_cpu_features()
+    {
+        utility::CpuFeatures features = {};
+
+        uint32_t regs[4]; // eax, ebx, ecx, edx
+
+        _cpuid(0, 0, regs);
+        const uint32_t max_leaf = regs[0];
+
+        if (max_leaf < 1) {
+            return features;
+        }
+
+        _cpuid(1, 0, regs);
+
+        features.sse2 = (regs[3] & (1U << 26)) ? true : false;
+        features.pclmul = (regs[2] & (1U << 1)) ? true : false;
+        features.ssse3 = (regs[2] & (1U << 9)) ? true : false;
+        features.sse41 = (regs[2] & (1U << 19)) ? true : false;
+        features.sse42 = (regs[2] & (1U << 20)) ? true : false;
+        features.popcnt = (regs[2] & (1U << 23)) ? true : false;
+
+        const bool osxsave = (regs[2] & (1U << 27)) ? true : false;
+        const bool avx = (regs[2] & (1U << 28)) ? true : false;
+
+        // the OS must save the extended registers state on a context switch
+        const uint64_t xcr0 = osxsave ? _xgetbv0() : 0;
+        const bool avx_state = avx && (xcr0 & 0x06) == 0x06;
+        const bool avx512_state = avx_state && (xcr0 & 0xE0) == 0xE0;
+
+        if (max_leaf < 7) {
+            return features;
+        }
+
+        _cpuid(7, 0, regs);
+
+        features.avx2 = avx_state && (regs[1] & (1U << 5));
+        features.bmi2 = (regs[1] & (1U << 8)) ? true : false;
+        features.avx512f = avx512_state && (regs[1] & (1U << 16));
+        features.avx512bw = features.avx512f && (regs[1] & (1U << 30));
+
+        return features;
+    }
+}
+
+namespace utility
+{
+    const CpuFeatures & get_cpu_features()
+    {
+        static const CpuFeatures s_features = _detect_cpu_features();
+        return s_features;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+
+
+// Compiles a function for an instruction set extension without the global compiler flag, so the function can be
+// selected at runtime by the cpu features. The msvc does not need it to use intrinsics.
+#if defined(UTILITY_COMPILER_CXX_GCC)
+#define UTILITY_TARGET(x)   __attribute__((target(x)))
+#else
+#define UTILITY_TARGET(x)
+#endif
+
+
+namespace utility
+{
+    struct CpuFeatures
+    {
+        bool sse2;
+        bool ssse3;
+        bool sse41;
+        bool sse42;
+        bool popcnt;
+        bool pclmul;
+        bool avx2;          // including the OS support of the AVX state
+        bool avx512f;       // including the OS support of the AVX-512 state
+        bool avx512bw;
+        bool bmi2;
+    };
+
+    // detected once on the first call
+    const CpuFeatures & get_cpu_features();
+}
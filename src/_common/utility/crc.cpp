@@ -1,99 +1,909 @@
-#include <utility/crc.hpp>
-#include <utility/crc_tables.hpp>
-#include <utility/assert.hpp>
-#include <utility/utility.hpp>
-
-namespace
-{
-    template <typename T>
-    FORCE_INLINE T _t_crc(size_t width, const T * table, T crc, const void * buf, size_t size, T crc_init, T xor_in, T xor_out, bool input_reflected, bool result_reflected)
-    {
-        ASSERT_GE(sizeof(crc) * CHAR_BIT, width);
-
-        const uint8_t * p = (const uint8_t *)buf;
-
-        if (!crc && crc_init) crc = crc_init;
-
-        crc ^= xor_in;
-
-        while (size--) {
-            const uint8_t buf_byte = input_reflected ? *p++ : utility::reverse(*p++); // LSB if true
-            crc = table[(crc ^ buf_byte) & 0xFF] ^ (crc >> 8);
-        }
-
-        if (!result_reflected) { // already reflected if true
-            crc = (utility::reverse(crc) >> (sizeof(crc) * CHAR_BIT - width));
-        }
-
-        return crc ^ xor_out;
-    }
-}
-
-namespace utility
-{
-    // NOTE:
-    // 1. Online generator: http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
-    // 2. Understanding:    http://www.sunshine2k.de/articles/coding/crc/understanding_crc.html
-    // 3. RFC1662 (HDLC FCS implementation): https://tools.ietf.org/html/rfc1662
-
-    extern FORCE_INLINE uint32_t crc(size_t width, uint32_t polynomial, uint32_t crc, const void * buf, size_t size, uint32_t crc_init,
-        uint32_t xor_in, uint32_t xor_out, bool input_reflected, bool result_reflected)
-    {
-        switch (width) {
-        case 16:
-            switch (polynomial) {
-            case 0x1021: return _t_crc<uint16_t>(width, g_crc16_1021, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0x8005: return _t_crc<uint16_t>(width, g_crc16_8005, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0xC867: return _t_crc<uint16_t>(width, g_crc16_C867, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0x0589: return _t_crc<uint16_t>(width, g_crc16_0589, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0x3D65: return _t_crc<uint16_t>(width, g_crc16_3D65, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0x8BB7: return _t_crc<uint16_t>(width, g_crc16_8BB7, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            case 0xA097: return _t_crc<uint16_t>(width, g_crc16_A097, uint16_t(crc), buf, size, uint16_t(crc_init), uint16_t(xor_in), uint16_t(xor_out), input_reflected, result_reflected);
-            }
-            break;
-
-        case 24:
-            switch (polynomial) {
-            case 0x864CFB: return _t_crc<uint32_t>(width, g_crc24_864CFB, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0x5D6DCB: return _t_crc<uint32_t>(width, g_crc24_5D6DCB, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            }
-            break;
-
-        case 32:
-            switch (polynomial) {
-            case 0x04C11DB7: return _t_crc<uint32_t>(width, g_crc32_04C11DB7, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0x1EDC6F41: return _t_crc<uint32_t>(width, g_crc32_1EDC6F41, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0xA833982B: return _t_crc<uint32_t>(width, g_crc32_A833982B, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0x814141AB: return _t_crc<uint32_t>(width, g_crc32_814141AB, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0x741B8CD7: return _t_crc<uint32_t>(width, g_crc32_741B8CD7, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            case 0x000000AF: return _t_crc<uint32_t>(width, g_crc32_000000AF, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected);
-            }
-            break;
-        }
-
-        ASSERT_TRUE(0); // not implemented
-
-        throw std::runtime_error(
-            (boost::format(
-                BOOST_PP_CAT(__FUNCTION__, ": unimplemented crc polynomial: width=%u polynomial=%08X")) %
-                    width % polynomial).str());
-
-        //return 0; // unreachable code
-    }
-
-    extern FORCE_INLINE uint32_t crc_mask(size_t width)
-    {
-        switch (width) {
-        case 8: return 0xFFU;
-        case 16: return 0xFFFFU;
-        case 24: return 0xFFFFFFU;
-        case 32: return 0xFFFFFFFFU;
-        }
-
-        uint32_t mask = 0;
-        for (size_t i = 0; i < width; i++) {
-            mask |= (0x01U << i);
-        }
-        return mask;
-    }
-}
+#include <utility/crc.hpp>
+#include <utility/crc_tables.hpp>
+#include <utility/cpu.hpp>
+#include <utility/assert.hpp>
+#include <utility/utility.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <cstring>
+
+namespace utility
+{
+    struct CrcEngine
+    {
+        const void *    tables;
+        uint64_t        (* update_func)(const void * tables, size_t width, uint64_t crc, const void * buf, size_t size, bool input_reflected,
+                            CrcKernel kernel);
+        bool            is_crc32c;
+        bool            has_normal_tables;  // MSB-first tables for the not reflected input, the width is not less than 8
+    };
+}
+
+namespace
+{
+    // buffer sizes from which the slicing kernels are faster than the table lookup per byte
+    const size_t s_crc_slice8_min_size = 16;
+    const size_t s_crc_slice16_min_size = 128;
+    const size_t s_crc_pclmul_min_size = 64;
+
+    FORCE_INLINE uint64_t _reverse_bits_in_bytes64(uint64_t value)
+    {
+        value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >> 4) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        value = ((value & 0xCCCCCCCCCCCCCCCCULL) >> 2) | ((value & 0x3333333333333333ULL) << 2);
+        value = ((value & 0xAAAAAAAAAAAAAAAAULL) >> 1) | ((value & 0x5555555555555555ULL) << 1);
+        return value;
+    }
+
+    // loads 8 bytes of the input in the reflected (LSB first) order
+    FORCE_INLINE uint64_t _load_crc_input64(const uint8_t * p, bool input_reflected)
+    {
+        uint64_t value;
+        memcpy(&value, p, sizeof(value)); // little endian
+        return input_reflected ? value : _reverse_bits_in_bytes64(value);
+    }
+
+    FORCE_INLINE uint64_t _byteswap64(uint64_t value)
+    {
+#ifdef UTILITY_COMPILER_CXX_MSC
+        return _byteswap_uint64(value);
+#else
+        return __builtin_bswap64(value);
+#endif
+    }
+
+    // loads 8 bytes of the input in the MSB first order
+    FORCE_INLINE uint64_t _load_crc_input64_msb(const uint8_t * p)
+    {
+        uint64_t value;
+        memcpy(&value, p, sizeof(value)); // little endian
+        return _byteswap64(value);
+    }
+
+    // the crc register is the reflected crc in the low bits, so it is xored into the first bytes of the input word
+    template <typename T>
+    FORCE_INLINE T _crc_slice8(const T * tables, T crc, uint64_t value)
+    {
+        value ^= crc;
+        return T(
+            tables[7 * 256 + (value & 0xFF)] ^ tables[6 * 256 + ((value >> 8) & 0xFF)] ^
+            tables[5 * 256 + ((value >> 16) & 0xFF)] ^ tables[4 * 256 + ((value >> 24) & 0xFF)] ^
+            tables[3 * 256 + ((value >> 32) & 0xFF)] ^ tables[2 * 256 + ((value >> 40) & 0xFF)] ^
+            tables[1 * 256 + ((value >> 48) & 0xFF)] ^ tables[0 * 256 + (value >> 56)]);
+    }
+
+    template <typename T>
+    FORCE_INLINE T _crc_slice16(const T * tables, T crc, uint64_t value0, uint64_t value1)
+    {
+        value0 ^= crc;
+        return T(
+            tables[15 * 256 + (value0 & 0xFF)] ^ tables[14 * 256 + ((value0 >> 8) & 0xFF)] ^
+            tables[13 * 256 + ((value0 >> 16) & 0xFF)] ^ tables[12 * 256 + ((value0 >> 24) & 0xFF)] ^
+            tables[11 * 256 + ((value0 >> 32) & 0xFF)] ^ tables[10 * 256 + ((value0 >> 40) & 0xFF)] ^
+            tables[9 * 256 + ((value0 >> 48) & 0xFF)] ^ tables[8 * 256 + (value0 >> 56)] ^
+            tables[7 * 256 + (value1 & 0xFF)] ^ tables[6 * 256 + ((value1 >> 8) & 0xFF)] ^
+            tables[5 * 256 + ((value1 >> 16) & 0xFF)] ^ tables[4 * 256 + ((value1 >> 24) & 0xFF)] ^
+            tables[3 * 256 + ((value1 >> 32) & 0xFF)] ^ tables[2 * 256 + ((value1 >> 40) & 0xFF)] ^
+            tables[1 * 256 + ((value1 >> 48) & 0xFF)] ^ tables[0 * 256 + (value1 >> 56)]);
+    }
+
+    // Carry-less multiplication folding (Intel "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ").
+    //
+    // A crc of the width up to 64 bits is computed as the 64-bit crc of the polynomial `G = x^64 + P * x^(64 - width)`,
+    // where the reflected register of the width is the low bits of the reflected 64-bit register. All values are
+    // reflected: the bit `i` of a 64-bit value is the coefficient of `x^(63 - i)`. The carry-less product of reflected
+    // values is the product multiplied by `x`, so the constant to multiply by `x^n` is `x^(n - 1) mod G`.
+    //
+    struct CrcFoldConstants
+    {
+        uint64_t fold4[2];      // x^(512 + 64 - 1), x^(512 - 1): folds 64 bytes
+        uint64_t fold3[2];      // x^(384 + 64 - 1), x^(384 - 1)
+        uint64_t fold2[2];      // x^(256 + 64 - 1), x^(256 - 1)
+        uint64_t fold1[2];      // x^(128 + 64 - 1), x^(128 - 1): folds 16 bytes
+        uint64_t reduce[2];     // x^(128 - 1), 0: reduces 128 bits to 64 bits times x^64
+        uint64_t mu[2];         // floor(x^128 / G) - x^64, 0: Barrett quotient
+        uint64_t poly[2];       // G - x^64, 0
+    };
+
+    FORCE_INLINE uint64_t _reverse_bits64(uint64_t value)
+    {
+        value = (value >> 32) | (value << 32);
+        value = ((value & 0xFFFF0000FFFF0000ULL) >> 16) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+        value = ((value & 0xFF00FF00FF00FF00ULL) >> 8) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+        value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >> 4) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        value = ((value & 0xCCCCCCCCCCCCCCCCULL) >> 2) | ((value & 0x3333333333333333ULL) << 2);
+        value = ((value & 0xAAAAAAAAAAAAAAAAULL) >> 1) | ((value & 0x5555555555555555ULL) << 1);
+        return value;
+    }
+
+    // x^n mod G in the normal (not reflected) form, where `poly` is G - x^64
+    uint64_t _crc_xpow_mod(size_t n, uint64_t poly)
+    {
+        uint64_t value = 1;
+        for (size_t i = 0; i < n; i++) {
+            value = (value << 1) ^ ((value >> 63) ? poly : 0);
+        }
+        return value;
+    }
+
+    // floor(x^128 / G) - x^64 in the normal form by the long division
+    uint64_t _crc_barrett_mu(uint64_t poly)
+    {
+        uint64_t dividend[3] = { 0, 0, 1 }; // x^128
+        uint64_t quotient = 0;
+
+        for (size_t i = 129; i-- > 64;) {
+            if (!((dividend[i / 64] >> (i % 64)) & 1)) continue;
+            if (i < 128) {
+                quotient |= uint64_t(1) << (i - 64);
+            }
+            for (size_t j = 0; j <= 64; j++) {
+                if (j == 64 || ((poly >> j) & 1)) {
+                    const size_t k = i - 64 + j;
+                    dividend[k / 64] ^= uint64_t(1) << (k % 64);
+                }
+            }
+        }
+
+        return quotient;
+    }
+
+    // the reflected polynomial of the width is the crc table entry of 0x80, which is G - x^64 reflected
+    CrcFoldConstants _make_crc_fold_constants(uint64_t reflected_poly)
+    {
+        const uint64_t poly = _reverse_bits64(reflected_poly);
+
+        CrcFoldConstants constants = {};
+
+        constants.fold4[0] = _reverse_bits64(_crc_xpow_mod(512 + 64 - 1, poly));
+        constants.fold4[1] = _reverse_bits64(_crc_xpow_mod(512 - 1, poly));
+        constants.fold3[0] = _reverse_bits64(_crc_xpow_mod(384 + 64 - 1, poly));
+        constants.fold3[1] = _reverse_bits64(_crc_xpow_mod(384 - 1, poly));
+        constants.fold2[0] = _reverse_bits64(_crc_xpow_mod(256 + 64 - 1, poly));
+        constants.fold2[1] = _reverse_bits64(_crc_xpow_mod(256 - 1, poly));
+        constants.fold1[0] = _reverse_bits64(_crc_xpow_mod(128 + 64 - 1, poly));
+        constants.fold1[1] = _reverse_bits64(_crc_xpow_mod(128 - 1, poly));
+        constants.reduce[0] = constants.fold1[1];
+        constants.mu[0] = _reverse_bits64(_crc_barrett_mu(poly));
+        constants.poly[0] = reflected_poly;
+
+        return constants;
+    }
+
+    template <typename T, size_t width, T polynomial>
+    const CrcFoldConstants & _get_crc_fold_constants()
+    {
+        static const CrcFoldConstants s_constants = _make_crc_fold_constants(uint64_t(utility::CrcTable<T, width, polynomial>::table.values[0x80]));
+        return s_constants;
+    }
+
+    UTILITY_TARGET("pclmul,ssse3")
+    FORCE_INLINE __m128i _crc_load_input128(const uint8_t * p, bool input_reflected, __m128i nibble_table, __m128i high_nibble_table, __m128i nibble_mask)
+    {
+        const __m128i value = _mm_loadu_si128((const __m128i *)p);
+        if (input_reflected) {
+            return value;
+        }
+
+        // reverse bits in each byte
+        const __m128i low_nibbles = _mm_and_si128(value, nibble_mask);
+        const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(value, 4), nibble_mask);
+        return _mm_or_si128(_mm_shuffle_epi8(high_nibble_table, low_nibbles), _mm_shuffle_epi8(nibble_table, high_nibbles));
+    }
+
+    // x * x^d + y, where the constant has x^(d + 64 - 1) and x^(d - 1)
+    UTILITY_TARGET("pclmul,ssse3")
+    FORCE_INLINE __m128i _crc_fold128(__m128i x, __m128i y, __m128i constant)
+    {
+        return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, constant, 0x00), _mm_clmulepi64_si128(x, constant, 0x11)), y);
+    }
+
+    // Returns the reflected 64-bit register after the whole 16 bytes blocks, the size must be at least 16 bytes.
+    UTILITY_TARGET("pclmul,ssse3")
+    uint64_t _crc_fold_pclmul(const CrcFoldConstants & constants, uint64_t crc, const uint8_t * p, size_t size, bool input_reflected)
+    {
+        const __m128i nibble_table = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+        const __m128i high_nibble_table = _mm_setr_epi8(0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0);
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+        // the register is the highest 64 bits of the first block
+        uint64_t crc_block[2] = { crc, 0 };
+        const __m128i crc_value = _mm_loadu_si128((const __m128i *)crc_block);
+
+        __m128i x0 = _mm_xor_si128(_crc_load_input128(p, input_reflected, nibble_table, high_nibble_table, nibble_mask), crc_value);
+        p += 16;
+        size -= 16;
+
+        if (size >= 48) {
+            __m128i x1 = _crc_load_input128(p, input_reflected, nibble_table, high_nibble_table, nibble_mask);
+            __m128i x2 = _crc_load_input128(p + 16, input_reflected, nibble_table, high_nibble_table, nibble_mask);
+            __m128i x3 = _crc_load_input128(p + 32, input_reflected, nibble_table, high_nibble_table, nibble_mask);
+            p += 48;
+            size -= 48;
+
+            const __m128i fold4 = _mm_loadu_si128((const __m128i *)constants.fold4);
+
+            for (; size >= 64; size -= 64, p += 64) {
+                x0 = _crc_fold128(x0, _crc_load_input128(p, input_reflected, nibble_table, high_nibble_table, nibble_mask), fold4);
+                x1 = _crc_fold128(x1, _crc_load_input128(p + 16, input_reflected, nibble_table, high_nibble_table, nibble_mask), fold4);
+                x2 = _crc_fold128(x2, _crc_load_input128(p + 32, input_reflected, nibble_table, high_nibble_table, nibble_mask), fold4);
+                x3 = _crc_fold128(x3, _crc_load_input128(p + 48, input_reflected, nibble_table, high_nibble_table, nibble_mask), fold4);
+            }
+
+            // x0 * x^384 + x1 * x^256 + x2 * x^128 + x3
+            x2 = _crc_fold128(x2, x3, _mm_loadu_si128((const __m128i *)constants.fold1));
+            x1 = _crc_fold128(x1, x2, _mm_loadu_si128((const __m128i *)constants.fold2));
+            x0 = _crc_fold128(x0, x1, _mm_loadu_si128((const __m128i *)constants.fold3));
+        }
+
+        const __m128i fold1 = _mm_loadu_si128((const __m128i *)constants.fold1);
+
+        for (; size >= 16; size -= 16, p += 16) {
+            x0 = _crc_fold128(x0, _crc_load_input128(p, input_reflected, nibble_table, high_nibble_table, nibble_mask), fold1);
+        }
+
+        // 128 bits times x^64 to 128 bits: the high 64 bits times x^128 plus the low 64 bits times x^64
+        const __m128i t = _mm_xor_si128(_mm_clmulepi64_si128(x0, _mm_loadu_si128((const __m128i *)constants.reduce), 0x00), _mm_srli_si128(x0, 8));
+
+        // Barrett reduction: q = floor(t_high * x^64 / G), crc = t_low + (q * G mod x^64)
+        const __m128i mu_product = _mm_clmulepi64_si128(t, _mm_loadu_si128((const __m128i *)constants.mu), 0x00);
+        const __m128i q = _mm_xor_si128(t, _mm_slli_epi64(mu_product, 1));
+        const __m128i poly_product = _mm_clmulepi64_si128(q, _mm_loadu_si128((const __m128i *)constants.poly), 0x00);
+        const __m128i poly_product_low = _mm_or_si128(_mm_slli_epi64(_mm_srli_si128(poly_product, 8), 1), _mm_srli_epi64(poly_product, 63));
+
+        uint64_t result[2];
+        _mm_storeu_si128((__m128i *)result, _mm_xor_si128(_mm_srli_si128(t, 8), poly_product_low));
+
+        return result[0];
+    }
+
+    // Multiplication modulo G of reflected 64-bit values, where the bit 63 is the coefficient of x^0 and `reflected_poly` is
+    // G - x^64 reflected. A crc register of the width is the 64-bit register of `x^64 + P * x^(64 - width)` as above.
+    uint64_t _crc_multmod64(uint64_t a, uint64_t b, uint64_t reflected_poly)
+    {
+        uint64_t product = 0;
+        for (uint64_t mask = uint64_t(1) << 63; mask; mask >>= 1) {
+            if (a & mask) {
+                product ^= b;
+            }
+            b = (b & 1) ? (b >> 1) ^ reflected_poly : (b >> 1);
+        }
+        return product;
+    }
+
+    // x^(8 * size) mod G by the square-and-multiply
+    uint64_t _crc_xpow8n_mod64(uint64_t size, uint64_t reflected_poly)
+    {
+        uint64_t value = uint64_t(1) << 63; // x^0
+        uint64_t square = uint64_t(1) << (63 - 8); // x^8
+
+        for (; size; size >>= 1) {
+            if (size & 1) {
+                value = _crc_multmod64(value, square, reflected_poly);
+            }
+            square = _crc_multmod64(square, square, reflected_poly);
+        }
+
+        return value;
+    }
+
+    // CRC-32C (Castagnoli) by the SSE4.2 `crc32` instruction.
+    //
+    // The instruction has the latency of 3 cycles and the throughput of 1 per cycle, so the buffer is processed by 3
+    // interleaved streams of the same size. The stream registers are combined as `crc0 * x^(2n) + crc1 * x^n + crc2`,
+    // where `n` is the stream size in bits and the shifts are multiplications by the precomputed `x^n mod P`.
+    //
+    const uint32_t s_crc32c_reflected_poly = 0x82F63B78;
+
+    // multiplication modulo P of reflected values, where the bit 31 is the coefficient of x^0
+    uint32_t _crc32c_multmod(uint32_t a, uint32_t b)
+    {
+        uint32_t product = 0;
+        for (uint32_t mask = 0x80000000U; mask; mask >>= 1) {
+            if (a & mask) {
+                product ^= b;
+            }
+            b = (b & 1) ? (b >> 1) ^ s_crc32c_reflected_poly : (b >> 1);
+        }
+        return product;
+    }
+
+    // x^(8 * size) mod P
+    uint32_t _crc32c_xpow8n(size_t size)
+    {
+        uint32_t value = 0x80000000U; // x^0
+        for (size_t i = 0; i < size * CHAR_BIT; i++) {
+            value = (value & 1) ? (value >> 1) ^ s_crc32c_reflected_poly : (value >> 1);
+        }
+        return value;
+    }
+
+    struct Crc32cStreams
+    {
+        size_t stream_size;
+        uint32_t shift1;    // x^(8 * stream_size) mod P
+        uint32_t shift2;    // x^(16 * stream_size) mod P
+    };
+
+    const Crc32cStreams * _get_crc32c_streams()
+    {
+        // long streams for large buffers and short streams for the rest
+        static const Crc32cStreams s_streams[2] = {
+            { 8192, _crc32c_xpow8n(8192), _crc32c_xpow8n(8192 * 2) },
+            { 256, _crc32c_xpow8n(256), _crc32c_xpow8n(256 * 2) }
+        };
+        return s_streams;
+    }
+
+#if defined(_M_X64) || defined(__x86_64__)
+    typedef uint64_t Crc32cWord;
+
+    UTILITY_TARGET("sse4.2")
+    FORCE_INLINE uint32_t _crc32c_word(uint32_t crc, Crc32cWord value)
+    {
+        return uint32_t(_mm_crc32_u64(crc, value));
+    }
+#else
+    typedef uint32_t Crc32cWord;
+
+    UTILITY_TARGET("sse4.2")
+    FORCE_INLINE uint32_t _crc32c_word(uint32_t crc, Crc32cWord value)
+    {
+        return _mm_crc32_u32(crc, value);
+    }
+#endif
+
+    UTILITY_TARGET("sse4.2")
+    uint32_t _crc32c_sse42(uint32_t crc, const uint8_t * p, size_t size)
+    {
+        const Crc32cStreams * streams = _get_crc32c_streams();
+
+        for (size_t i = 0; i < 2; i++) {
+            const size_t stream_size = streams[i].stream_size;
+
+            for (; size >= stream_size * 3; size -= stream_size * 3, p += stream_size * 3) {
+                uint32_t crc1 = 0;
+                uint32_t crc2 = 0;
+
+                for (size_t j = 0; j < stream_size; j += sizeof(Crc32cWord)) {
+                    Crc32cWord values[3];
+                    memcpy(&values[0], p + j, sizeof(Crc32cWord));
+                    memcpy(&values[1], p + stream_size + j, sizeof(Crc32cWord));
+                    memcpy(&values[2], p + stream_size * 2 + j, sizeof(Crc32cWord));
+                    crc = _crc32c_word(crc, values[0]);
+                    crc1 = _crc32c_word(crc1, values[1]);
+                    crc2 = _crc32c_word(crc2, values[2]);
+                }
+
+                crc = _crc32c_multmod(crc, streams[i].shift2) ^ _crc32c_multmod(crc1, streams[i].shift1) ^ crc2;
+            }
+        }
+
+        for (; size >= sizeof(Crc32cWord); size -= sizeof(Crc32cWord), p += sizeof(Crc32cWord)) {
+            Crc32cWord value;
+            memcpy(&value, p, sizeof(Crc32cWord));
+            crc = _crc32c_word(crc, value);
+        }
+
+        for (; size; size--) {
+            crc = _mm_crc32_u8(crc, *p++);
+        }
+
+        return crc;
+    }
+
+    // tables of a crc polynomial for the kernels
+    template <typename T>
+    struct CrcTables
+    {
+        const T *                   table;                  // reflected crc table
+        const T *                   slicing_tables;         // 16 reflected slicing tables, where the slice 0 is the crc table
+        const T *                   normal_table;           // MSB-first crc table, null for the width less than 8
+        const T *                   normal_slicing_tables;  // 16 MSB-first slicing tables, null for the width less than 8
+        const CrcFoldConstants *    fold_constants;
+        bool                        is_crc32c;              // CRC-32C polynomial for the SSE4.2 `crc32` instruction
+    };
+
+    // MSB-first kernels: the register is aligned to the width and the input bytes are in the natural bit order, so
+    // neither the input bytes nor the register are reflected.
+    template <typename T>
+    FORCE_INLINE T _crc_normal_byte(const T * table, size_t width, T mask, T crc, uint8_t value)
+    {
+        return T(((crc << 8) & mask) ^ table[((crc >> (width - 8)) ^ value) & 0xFF]);
+    }
+
+    // the crc register is in the highest bits of the big endian input word
+    template <typename T>
+    FORCE_INLINE T _crc_normal_slice8(const T * tables, size_t width, T crc, uint64_t value)
+    {
+        value ^= uint64_t(crc) << (64 - width);
+        return T(
+            tables[7 * 256 + (value >> 56)] ^ tables[6 * 256 + ((value >> 48) & 0xFF)] ^
+            tables[5 * 256 + ((value >> 40) & 0xFF)] ^ tables[4 * 256 + ((value >> 32) & 0xFF)] ^
+            tables[3 * 256 + ((value >> 24) & 0xFF)] ^ tables[2 * 256 + ((value >> 16) & 0xFF)] ^
+            tables[1 * 256 + ((value >> 8) & 0xFF)] ^ tables[0 * 256 + (value & 0xFF)]);
+    }
+
+    template <typename T>
+    FORCE_INLINE T _crc_normal_slice16(const T * tables, size_t width, T crc, uint64_t value0, uint64_t value1)
+    {
+        value0 ^= uint64_t(crc) << (64 - width);
+        return T(
+            tables[15 * 256 + (value0 >> 56)] ^ tables[14 * 256 + ((value0 >> 48) & 0xFF)] ^
+            tables[13 * 256 + ((value0 >> 40) & 0xFF)] ^ tables[12 * 256 + ((value0 >> 32) & 0xFF)] ^
+            tables[11 * 256 + ((value0 >> 24) & 0xFF)] ^ tables[10 * 256 + ((value0 >> 16) & 0xFF)] ^
+            tables[9 * 256 + ((value0 >> 8) & 0xFF)] ^ tables[8 * 256 + (value0 & 0xFF)] ^
+            tables[7 * 256 + (value1 >> 56)] ^ tables[6 * 256 + ((value1 >> 48) & 0xFF)] ^
+            tables[5 * 256 + ((value1 >> 40) & 0xFF)] ^ tables[4 * 256 + ((value1 >> 32) & 0xFF)] ^
+            tables[3 * 256 + ((value1 >> 24) & 0xFF)] ^ tables[2 * 256 + ((value1 >> 16) & 0xFF)] ^
+            tables[1 * 256 + ((value1 >> 8) & 0xFF)] ^ tables[0 * 256 + (value1 & 0xFF)]);
+    }
+
+    utility::CrcKernel _resolve_crc_kernel(const utility::CrcEngine & engine, bool input_reflected, utility::CrcKernel kernel)
+    {
+        const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+        const bool has_pclmul = cpu_features.pclmul && cpu_features.ssse3;
+        const bool has_crc32c = engine.is_crc32c && input_reflected && cpu_features.sse42;
+
+        if (kernel == utility::crc_kernel_crc32c && !has_crc32c) {
+            kernel = utility::crc_kernel_auto;
+        }
+
+        if (kernel == utility::crc_kernel_auto && has_crc32c) {
+            kernel = utility::crc_kernel_crc32c;
+        }
+        else if (kernel == utility::crc_kernel_pclmul && !has_pclmul) {
+            kernel = utility::crc_kernel_slice16;
+        }
+
+        return kernel;
+    }
+
+    // The kernel of a stream is resolved to a concrete kernel once instead of by the size of each update, where the pclmul
+    // kernel processes the tail less than 16 bytes by the table.
+    utility::CrcKernel _resolve_crc_stream_kernel(const utility::CrcEngine & engine, bool input_reflected, utility::CrcKernel kernel)
+    {
+        kernel = _resolve_crc_kernel(engine, input_reflected, kernel);
+
+        if (kernel == utility::crc_kernel_auto) {
+            const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+            const bool has_pclmul = cpu_features.pclmul && cpu_features.ssse3;
+
+            kernel = has_pclmul ? utility::crc_kernel_pclmul : utility::crc_kernel_slice16;
+        }
+
+        return kernel;
+    }
+
+    // The register is kept in the normal form (aligned to the width) by the MSB-first tables for the not reflected input, and
+    // in the reflected form otherwise.
+    bool _is_crc_normal_register(const utility::CrcEngine & engine, bool input_reflected)
+    {
+        return !input_reflected && engine.has_normal_tables;
+    }
+
+    // Updates the register by the buffer, where the register is in the form of `_is_crc_normal_register` and the kernel is
+    // resolved by `_resolve_crc_kernel`.
+    template <typename T>
+    T _t_crc_update(const CrcTables<T> & tables, size_t width, T crc, const void * buf, size_t size, bool input_reflected,
+        utility::CrcKernel kernel)
+    {
+        ASSERT_GE(sizeof(crc) * CHAR_BIT, width);
+
+        const T * table = tables.table;
+
+        const uint8_t * p = (const uint8_t *)buf;
+
+        const bool normal_register = !input_reflected && tables.normal_table;
+
+        if (kernel == utility::crc_kernel_auto) {
+            const utility::CpuFeatures & cpu_features = utility::get_cpu_features();
+            const bool has_pclmul = cpu_features.pclmul && cpu_features.ssse3;
+
+            kernel = has_pclmul && size >= s_crc_pclmul_min_size ? utility::crc_kernel_pclmul :
+                size >= s_crc_slice16_min_size ? utility::crc_kernel_slice16 :
+                size >= s_crc_slice8_min_size ? utility::crc_kernel_slice8 : utility::crc_kernel_table;
+        }
+
+        switch (kernel) {
+        case utility::crc_kernel_crc32c:
+        {
+            crc = T(_crc32c_sse42(uint32_t(crc), p, size));
+            size = 0;
+        } break;
+
+        case utility::crc_kernel_pclmul:
+        {
+            // the folding reflects the input bytes by the shuffles, so it is the same for the both input orders
+            if (size >= 16) {
+                // the folding is of the reflected register
+                if (normal_register) {
+                    crc = T(_reverse_bits64(crc) >> (64 - width));
+                }
+
+                crc = T(_crc_fold_pclmul(*tables.fold_constants, crc, p, size, input_reflected));
+
+                if (normal_register) {
+                    crc = T(_reverse_bits64(crc) >> (64 - width));
+                }
+
+                p += size & ~size_t(15);
+                size &= 15;
+            }
+        } break;
+
+        default:;
+        }
+
+        if (normal_register) {
+            const T mask = utility::_crc_mask_value<T>(width);
+
+            switch (kernel) {
+            case utility::crc_kernel_slice16:
+            {
+                for (; size >= 16; size -= 16, p += 16) {
+                    crc = _crc_normal_slice16(tables.normal_slicing_tables, width, crc, _load_crc_input64_msb(p), _load_crc_input64_msb(p + 8));
+                }
+            } break;
+
+            case utility::crc_kernel_slice8:
+            {
+                for (; size >= 8; size -= 8, p += 8) {
+                    crc = _crc_normal_slice8(tables.normal_slicing_tables, width, crc, _load_crc_input64_msb(p));
+                }
+            } break;
+
+            default:;
+            }
+
+            while (size--) {
+                crc = _crc_normal_byte(tables.normal_table, width, mask, crc, *p++);
+            }
+
+            return crc;
+        }
+
+        switch (kernel) {
+        case utility::crc_kernel_slice16:
+        {
+            for (; size >= 16; size -= 16, p += 16) {
+                crc = _crc_slice16(tables.slicing_tables, crc, _load_crc_input64(p, input_reflected), _load_crc_input64(p + 8, input_reflected));
+            }
+        } break;
+
+        case utility::crc_kernel_slice8:
+        {
+            for (; size >= 8; size -= 8, p += 8) {
+                crc = _crc_slice8(tables.slicing_tables, crc, _load_crc_input64(p, input_reflected));
+            }
+        } break;
+
+        default:;
+        }
+
+        while (size--) {
+            const uint8_t buf_byte = input_reflected ? *p++ : utility::reverse(*p++); // LSB if true
+            crc = table[(crc ^ buf_byte) & 0xFF] ^ (crc >> 8);
+        }
+
+        return crc;
+    }
+
+    template <typename T>
+    uint64_t _t_crc_update_func(const void * tables, size_t width, uint64_t crc, const void * buf, size_t size, bool input_reflected,
+        utility::CrcKernel kernel)
+    {
+        return _t_crc_update(*static_cast<const CrcTables<T> *>(tables), width, T(crc), buf, size, input_reflected, kernel);
+    }
+
+    // the tables of the polynomials known at compile time
+    template <typename T, size_t width, T polynomial>
+    const utility::CrcEngine & _get_crc_engine()
+    {
+        static const CrcTables<T> s_tables = {
+            utility::CrcTable<T, width, polynomial>::table.values,
+            utility::CrcTable<T, width, polynomial, true, 16>::table.values,
+            utility::CrcTable<T, width, polynomial, false>::table.values,
+            utility::CrcTable<T, width, polynomial, false, 16>::table.values,
+            &_get_crc_fold_constants<T, width, polynomial>(),
+            width == 32 && polynomial == 0x1EDC6F41
+        };
+
+        static const utility::CrcEngine s_engine = { &s_tables, _t_crc_update_func<T>, s_tables.is_crc32c, true };
+
+        return s_engine;
+    }
+
+    // The tables of the polynomials unknown at compile time, generated on the first use and cached in the registry
+    // for the process lifetime.
+    template <typename T>
+    struct CrcRuntimeTables
+    {
+        T                           slicing_tables[16 * 256];
+        T                           normal_slicing_tables[16 * 256];
+        CrcFoldConstants            fold_constants;
+        CrcTables<T>                tables;
+        utility::CrcEngine          engine;
+    };
+
+    template <typename T>
+    std::unique_ptr<CrcRuntimeTables<T> > _make_crc_runtime_tables(size_t width, T polynomial)
+    {
+        std::unique_ptr<CrcRuntimeTables<T> > runtime_tables(new CrcRuntimeTables<T>);
+
+        T * slicing_tables = runtime_tables->slicing_tables;
+
+        const T reflected_poly = T(_reverse_bits64(polynomial & utility::_crc_mask_value<uint64_t>(width)) >> (64 - width));
+
+        for (size_t b = 0; b < 256; b++) {
+            T value = T(b);
+            for (size_t i = 0; i < 8; i++) {
+                value = (value & 1) ? (value >> 1) ^ reflected_poly : (value >> 1);
+            }
+            slicing_tables[b] = value;
+        }
+
+        for (size_t k = 1; k < 16; k++) {
+            for (size_t b = 0; b < 256; b++) {
+                const T prev_value = slicing_tables[(k - 1) * 256 + b];
+                slicing_tables[k * 256 + b] = slicing_tables[prev_value & 0xFF] ^ (prev_value >> 8);
+            }
+        }
+
+        T * normal_slicing_tables = nullptr;
+
+        if (width >= 8) {
+            normal_slicing_tables = runtime_tables->normal_slicing_tables;
+
+            const T mask = utility::_crc_mask_value<T>(width);
+            const T msb = T(T(0x01) << (width - 1));
+
+            for (size_t b = 0; b < 256; b++) {
+                T value = T(T(b) << (width - 8));
+                for (size_t i = 0; i < 8; i++) {
+                    value = T(((value & msb) ? (value << 1) ^ polynomial : (value << 1)) & mask);
+                }
+                normal_slicing_tables[b] = value;
+            }
+
+            for (size_t k = 1; k < 16; k++) {
+                for (size_t b = 0; b < 256; b++) {
+                    const T prev_value = normal_slicing_tables[(k - 1) * 256 + b];
+                    normal_slicing_tables[k * 256 + b] = _crc_normal_byte(normal_slicing_tables, width, mask, prev_value, 0);
+                }
+            }
+        }
+
+        runtime_tables->fold_constants = _make_crc_fold_constants(reflected_poly);
+
+        runtime_tables->tables.table = slicing_tables;
+        runtime_tables->tables.slicing_tables = slicing_tables;
+        runtime_tables->tables.normal_table = normal_slicing_tables;
+        runtime_tables->tables.normal_slicing_tables = normal_slicing_tables;
+        runtime_tables->tables.fold_constants = &runtime_tables->fold_constants;
+        runtime_tables->tables.is_crc32c = (width == 32 && polynomial == 0x1EDC6F41);
+
+        runtime_tables->engine.tables = &runtime_tables->tables;
+        runtime_tables->engine.update_func = _t_crc_update_func<T>;
+        runtime_tables->engine.is_crc32c = runtime_tables->tables.is_crc32c;
+        runtime_tables->engine.has_normal_tables = (normal_slicing_tables != nullptr);
+
+        return runtime_tables;
+    }
+
+    template <typename T>
+    const utility::CrcEngine & _get_crc_runtime_engine(size_t width, T polynomial)
+    {
+        static std::mutex s_mutex;
+        static std::map<std::pair<size_t, T>, std::unique_ptr<CrcRuntimeTables<T> > > s_registry;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        std::unique_ptr<CrcRuntimeTables<T> > & runtime_tables = s_registry[std::make_pair(width, polynomial)];
+        if (!runtime_tables) {
+            runtime_tables = _make_crc_runtime_tables<T>(width, polynomial);
+        }
+
+        return runtime_tables->engine;
+    }
+
+    const utility::CrcEngine & _get_crc_engine(size_t width, uint64_t polynomial)
+    {
+        switch (width) {
+        case 16:
+            switch (polynomial) {
+            case 0x1021: return _get_crc_engine<uint16_t, 16, 0x1021>();
+            case 0x8005: return _get_crc_engine<uint16_t, 16, 0x8005>();
+            case 0xC867: return _get_crc_engine<uint16_t, 16, 0xC867>();
+            case 0x0589: return _get_crc_engine<uint16_t, 16, 0x0589>();
+            case 0x3D65: return _get_crc_engine<uint16_t, 16, 0x3D65>();
+            case 0x8BB7: return _get_crc_engine<uint16_t, 16, 0x8BB7>();
+            case 0xA097: return _get_crc_engine<uint16_t, 16, 0xA097>();
+            }
+            break;
+
+        case 24:
+            switch (polynomial) {
+            case 0x864CFB: return _get_crc_engine<uint32_t, 24, 0x864CFB>();
+            case 0x5D6DCB: return _get_crc_engine<uint32_t, 24, 0x5D6DCB>();
+            }
+            break;
+
+        case 32:
+            switch (polynomial) {
+            case 0x04C11DB7: return _get_crc_engine<uint32_t, 32, 0x04C11DB7>();
+            case 0x1EDC6F41: return _get_crc_engine<uint32_t, 32, 0x1EDC6F41>();
+            case 0xA833982B: return _get_crc_engine<uint32_t, 32, 0xA833982B>();
+            case 0x814141AB: return _get_crc_engine<uint32_t, 32, 0x814141AB>();
+            case 0x741B8CD7: return _get_crc_engine<uint32_t, 32, 0x741B8CD7>();
+            case 0x000000AF: return _get_crc_engine<uint32_t, 32, 0x000000AF>();
+            }
+            break;
+
+        case 64:
+            switch (polynomial) {
+            case 0x42F0E1EBA9EA3693ULL: return _get_crc_engine<uint64_t, 64, 0x42F0E1EBA9EA3693ULL>();
+            }
+            break;
+        }
+
+        // any other polynomial by the tables generated at runtime
+        if (width && width <= 32) {
+            return _get_crc_runtime_engine<uint32_t>(width, uint32_t(polynomial & utility::_crc_mask_value<uint64_t>(width)));
+        }
+
+        if (width > 32 && width <= 64) {
+            return _get_crc_runtime_engine<uint64_t>(width, polynomial & utility::_crc_mask_value<uint64_t>(width));
+        }
+
+        ASSERT_TRUE(0); // not implemented
+
+        throw std::runtime_error(
+            (boost::format(
+                BOOST_PP_CAT(__FUNCTION__, ": unsupported crc width: width=%u polynomial=%016llX")) %
+                    width % polynomial).str());
+    }
+
+    uint64_t _crc(size_t width, uint64_t polynomial, uint64_t crc, const void * buf, size_t size, uint64_t crc_init, uint64_t xor_in,
+        uint64_t xor_out, bool input_reflected, bool result_reflected, utility::CrcKernel kernel)
+    {
+        const utility::CrcEngine & engine = _get_crc_engine(width, polynomial);
+        const uint64_t mask = utility::_crc_mask_value<uint64_t>(width);
+
+        if (!crc && crc_init) crc = crc_init;
+
+        crc = (crc ^ xor_in) & mask;
+
+        const bool normal_register = _is_crc_normal_register(engine, input_reflected);
+
+        if (normal_register) {
+            crc = _reverse_bits64(crc) >> (64 - width);
+        }
+
+        crc = engine.update_func(engine.tables, width, crc, buf, size, input_reflected, _resolve_crc_kernel(engine, input_reflected, kernel));
+
+        if (normal_register == result_reflected) { // already in the result form if not equal
+            crc = _reverse_bits64(crc) >> (64 - width);
+        }
+
+        return (crc ^ xor_out) & mask;
+    }
+}
+
+namespace utility
+{
+    // NOTE:
+    // 1. Online generator: http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
+    // 2. Understanding:    http://www.sunshine2k.de/articles/coding/crc/understanding_crc.html
+    // 3. RFC1662 (HDLC FCS implementation): https://tools.ietf.org/html/rfc1662
+
+    uint32_t crc(size_t width, uint32_t polynomial, uint32_t crc, const void * buf, size_t size, uint32_t crc_init,
+        uint32_t xor_in, uint32_t xor_out, bool input_reflected, bool result_reflected, CrcKernel kernel)
+    {
+        if (!width || width > 32) {
+            ASSERT_TRUE(0); // not implemented
+
+            throw std::runtime_error(
+                (boost::format(
+                    BOOST_PP_CAT(__FUNCTION__, ": unsupported crc width: width=%u polynomial=%08X")) %
+                        width % polynomial).str());
+        }
+
+        return uint32_t(_crc(width, polynomial, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected, kernel));
+    }
+
+    uint64_t crc64(uint64_t polynomial, uint64_t crc, const void * buf, size_t size, uint64_t crc_init, uint64_t xor_in, uint64_t xor_out,
+        bool input_reflected, bool result_reflected, CrcKernel kernel)
+    {
+        return _crc(64, polynomial, crc, buf, size, crc_init, xor_in, xor_out, input_reflected, result_reflected, kernel);
+    }
+
+    CrcContext::CrcContext(size_t width, uint64_t polynomial, uint64_t crc_init, uint64_t xor_in, uint64_t xor_out, bool input_reflected,
+        bool result_reflected, CrcKernel kernel) :
+        m_engine(&_get_crc_engine(width, polynomial)),
+        m_width(width),
+        m_mask(_crc_mask_value<uint64_t>(width)),
+        m_crc_init(crc_init),
+        m_xor_in(xor_in),
+        m_xor_out(xor_out),
+        m_input_reflected(input_reflected),
+        m_result_reflected(result_reflected),
+        m_kernel(_resolve_crc_stream_kernel(*m_engine, input_reflected, kernel)),
+        m_normal_register(_is_crc_normal_register(*m_engine, input_reflected))
+    {
+        reset();
+    }
+
+    void CrcContext::reset()
+    {
+        m_register = (m_crc_init ^ m_xor_in) & m_mask;
+        if (m_normal_register) {
+            m_register = _reverse_bits64(m_register) >> (64 - m_width);
+        }
+        m_size = 0;
+    }
+
+    void CrcContext::update(const void * buf, size_t size)
+    {
+        m_register = m_engine->update_func(m_engine->tables, m_width, m_register, buf, size, m_input_reflected, m_kernel);
+        m_size += size;
+    }
+
+    uint64_t CrcContext::finalize() const
+    {
+        uint64_t crc = m_register;
+
+        if (m_normal_register == m_result_reflected) { // already in the result form if not equal
+            crc = _reverse_bits64(crc) >> (64 - m_width);
+        }
+
+        return (crc ^ m_xor_out) & m_mask;
+    }
+
+    uint64_t crc_combine(size_t width, uint64_t polynomial, uint64_t crc1, uint64_t crc2, uint64_t size2, uint64_t crc_init,
+        uint64_t xor_in, uint64_t xor_out, bool result_reflected)
+    {
+        ASSERT_TRUE(width && width <= 64);
+
+        const uint64_t mask = _crc_mask_value<uint64_t>(width);
+        const uint64_t reflected_poly = _reverse_bits64(polynomial & mask) >> (64 - width);
+
+        // registers in the reflected form before the output reflection and the xor
+        const auto register_from_crc = [&](uint64_t crc) -> uint64_t
+        {
+            crc = (crc ^ xor_out) & mask;
+            return result_reflected ? crc : _reverse_bits64(crc) >> (64 - width);
+        };
+
+        // the initial register of both crcs
+        const uint64_t init_register = (crc_init ^ xor_in) & mask;
+
+        // reg(A||B) = (reg(A) + reg0) * x^(8 * size2) + reg(B)
+        uint64_t value = _crc_multmod64(register_from_crc(crc1) ^ init_register, _crc_xpow8n_mod64(size2, reflected_poly), reflected_poly) ^
+            register_from_crc(crc2);
+
+        if (!result_reflected) {
+            value = _reverse_bits64(value) >> (64 - width);
+        }
+
+        return (value ^ xor_out) & mask;
+    }
+
+    uint32_t crc_mask(size_t width)
+    {
+        switch (width) {
+        case 8: return 0xFFU;
+        case 16: return 0xFFFFU;
+        case 24: return 0xFFFFFFU;
+        case 32: return 0xFFFFFFFFU;
+        }
+
+        uint32_t mask = 0;
+        for (size_t i = 0; i < width; i++) {
+            mask |= (0x01U << i);
+        }
+        return mask;
+    }
+}
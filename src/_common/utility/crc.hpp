@@ -1,27 +1,99 @@
-#pragma once
-
-#include <tacklelib.hpp>
-
-#include <utility/platform.hpp>
-
-#include <cstdint>
-
-#include <utility>
-
-
-// TODO:
-//  24-bit crc implementation is incomplete and untested
-
-
-namespace utility
-{
-    //polynomial example: x**0 + x**5 + x**12 + x**16
-    //                    (1)0001000000100001       = 0x1021
-    //                       1000010000001000(1)    = 0x8408
-    //polynomial example: x**0 + x**1 + x**2 + x**4 + x**5* +x**7 + x**8 + x**10 + x**11 + x**12 + x**16* +x**22 + x**23 + x**26 + x**32
-    //                    (1)00000100110000010001110110110111       = 0x04C11DB7
-    //                       11101101101110001000001100100000(1)    = 0xEDB88320
-    uint32_t crc(size_t width, uint32_t polynomial, uint32_t crc, const void * buf, size_t size, uint32_t crc_init = uint32_t(~0U),
-        uint32_t xor_in = 0U, uint32_t xor_out = uint32_t(~0U), bool input_reflected = false, bool result_reflected = false);
-    uint32_t crc_mask(size_t width);
-}
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+
+#include <cstdint>
+
+#include <utility>
+
+
+// TODO:
+//  24-bit crc implementation is incomplete and untested
+
+
+namespace utility
+{
+    enum CrcKernel
+    {
+        crc_kernel_auto = 0,    // selected by the buffer size
+        crc_kernel_table,       // a table lookup per byte
+        crc_kernel_slice8,      // slicing-by-8: 8 independent table lookups per 8 bytes
+        crc_kernel_slice16,     // slicing-by-16: 16 independent table lookups per 16 bytes
+        crc_kernel_pclmul,      // carry-less multiplication folding by 64 bytes with the Barrett reduction (PCLMULQDQ),
+                                // slicing-by-16 if the cpu has no support
+        crc_kernel_crc32c       // SSE4.2 `crc32` instruction by 3 interleaved streams, only for the 0x1EDC6F41 polynomial
+                                // (CRC-32C) with reflected input, auto otherwise
+    };
+
+    //polynomial example: x**0 + x**5 + x**12 + x**16
+    //                    (1)0001000000100001       = 0x1021
+    //                       1000010000001000(1)    = 0x8408
+    //polynomial example: x**0 + x**1 + x**2 + x**4 + x**5* +x**7 + x**8 + x**10 + x**11 + x**12 + x**16* +x**22 + x**23 + x**26 + x**32
+    //                    (1)00000100110000010001110110110111       = 0x04C11DB7
+    //                       11101101101110001000001100100000(1)    = 0xEDB88320
+    //
+    // The polynomial is in the normal form. The tables of a polynomial outside of the builtin list are generated on the
+    // first use and cached for the process lifetime, so any polynomial of the width in the range [1, 32] is supported.
+    uint32_t crc(size_t width, uint32_t polynomial, uint32_t crc, const void * buf, size_t size, uint32_t crc_init = uint32_t(~0U),
+        uint32_t xor_in = 0U, uint32_t xor_out = uint32_t(~0U), bool input_reflected = false, bool result_reflected = false,
+        CrcKernel kernel = crc_kernel_auto);
+
+    // 64-bit crc with the same parameters as `crc`:
+    //  CRC-64/ECMA-182:    polynomial=0x42F0E1EBA9EA3693 crc_init=0 xor_out=0 input_reflected=false result_reflected=false
+    //  CRC-64/XZ:          polynomial=0x42F0E1EBA9EA3693 crc_init=~0 xor_out=~0 input_reflected=true result_reflected=true
+    //
+    uint64_t crc64(uint64_t polynomial, uint64_t crc, const void * buf, size_t size, uint64_t crc_init = uint64_t(~0ULL),
+        uint64_t xor_in = 0U, uint64_t xor_out = uint64_t(~0ULL), bool input_reflected = false, bool result_reflected = false,
+        CrcKernel kernel = crc_kernel_auto);
+
+    // resolved tables and kernels of a crc polynomial
+    struct CrcEngine;
+
+    // Streaming crc with the same parameters as `crc` (the width is up to 64 bits), where the polynomial tables and the
+    // kernel are resolved once in the constructor. The context can be updated after `finalize`.
+    //
+    class CrcContext
+    {
+    public:
+        CrcContext(size_t width, uint64_t polynomial, uint64_t crc_init = uint64_t(~0ULL), uint64_t xor_in = 0U,
+            uint64_t xor_out = uint64_t(~0ULL), bool input_reflected = false, bool result_reflected = false,
+            CrcKernel kernel = crc_kernel_auto);
+
+        CrcContext(const CrcContext &) = default;
+
+        void reset();
+        void update(const void * buf, size_t size);
+        uint64_t finalize() const;
+
+        // number of bytes since the last reset
+        uint64_t size() const
+        {
+            return m_size;
+        }
+
+    private:
+        const CrcEngine *   m_engine;
+        size_t              m_width;
+        uint64_t            m_mask;
+        uint64_t            m_crc_init;
+        uint64_t            m_xor_in;
+        uint64_t            m_xor_out;
+        bool                m_input_reflected;
+        bool                m_result_reflected;
+        CrcKernel           m_kernel;
+        bool                m_normal_register;
+        uint64_t            m_register;     // reflected register, or aligned to the width by the MSB-first tables
+        uint64_t            m_size;
+    };
+
+    // Returns the crc of the concatenation of 2 buffers by the crc of the first buffer, the crc of the second buffer and
+    // the size of the second buffer, where both crcs are computed by `crc` with the same parameters from the initial crc.
+    // The crc of the first buffer is shifted by `x^(8 * size2) mod P` (square-and-multiply), so any width up to 64 bits
+    // and any polynomial is supported, the input reflection does not change the combination.
+    uint64_t crc_combine(size_t width, uint64_t polynomial, uint64_t crc1, uint64_t crc2, uint64_t size2, uint64_t crc_init = uint64_t(~0ULL),
+        uint64_t xor_in = 0U, uint64_t xor_out = uint64_t(~0ULL), bool result_reflected = false);
+
+    uint32_t crc_mask(size_t width);
+}
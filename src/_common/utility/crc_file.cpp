@@ -0,0 +1,144 @@
+#include <utility/crc_file.hpp>
+#include <utility/assert.hpp>
+#include <utility/utility.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+
+namespace
+{
+    // read chunk size per thread
+    const size_t s_crc_file_chunk_size = 8 * 1024 * 1024;
+
+    // segments smaller than this are not worth a thread
+    const uint64_t s_crc_file_min_segment_size = 4 * 1024 * 1024;
+
+    struct CrcParams
+    {
+        size_t              width;
+        uint64_t            polynomial;
+        uint64_t            crc_init;
+        uint64_t            xor_in;
+        uint64_t            xor_out;
+        bool                input_reflected;
+        bool                result_reflected;
+        utility::CrcKernel  kernel;
+    };
+
+    uint64_t _crc_file_segment(const CrcParams & params, const std::string & file_path, uint64_t offset, uint64_t size)
+    {
+        utility::CrcContext crc_context(params.width, params.polynomial, params.crc_init, params.xor_in, params.xor_out, params.input_reflected,
+            params.result_reflected, params.kernel);
+
+        if (!size) {
+            return crc_context.finalize();
+        }
+
+        const utility::FileHandle file_handle = utility::open_file(file_path, "rb", _SH_DENYWR);
+
+        if (_fseeki64(file_handle.get(), int64_t(offset), SEEK_SET)) {
+            utility::debug_break();
+            throw std::system_error{ errno, std::system_category(), file_path };
+        }
+
+        std::vector<uint8_t> buf(size_t((std::min)(size, uint64_t(s_crc_file_chunk_size))));
+
+        while (size) {
+            const size_t chunk_size = size_t((std::min)(size, uint64_t(buf.size())));
+
+            const size_t read_size = fread(&buf[0], 1, chunk_size, file_handle.get());
+            const int file_read_err = ferror(file_handle.get());
+            if (read_size < chunk_size) {
+                utility::debug_break();
+                throw std::system_error{ file_read_err, std::system_category(), file_path };
+            }
+
+            crc_context.update(&buf[0], chunk_size);
+
+            size -= chunk_size;
+        }
+
+        return crc_context.finalize();
+    }
+}
+
+namespace utility
+{
+    uint64_t crc_file(size_t width, uint64_t polynomial, const std::string & file_path, uint64_t crc_init, uint64_t xor_in, uint64_t xor_out,
+        bool input_reflected, bool result_reflected, size_t num_threads, CrcKernel kernel)
+    {
+        const CrcParams params = { width, polynomial, crc_init, xor_in, xor_out, input_reflected, result_reflected, kernel };
+
+        uint64_t file_size;
+        {
+            const FileHandle file_handle = open_file(file_path, "rb", _SH_DENYWR);
+            file_size = get_file_size(file_handle);
+        }
+
+        if (!num_threads) {
+            num_threads = (std::max)(std::thread::hardware_concurrency(), 1U);
+        }
+
+        num_threads = size_t((std::max)((std::min)(uint64_t(num_threads), file_size / s_crc_file_min_segment_size), uint64_t(1)));
+
+        const uint64_t segment_size = file_size / num_threads;
+
+        std::vector<uint64_t> segment_crcs(num_threads);
+        std::vector<uint64_t> segment_sizes(num_threads);
+        std::vector<std::exception_ptr> segment_errors(num_threads);
+
+        const auto process_segment = [&](size_t index)
+        {
+            const uint64_t offset = index * segment_size;
+            segment_sizes[index] = index + 1 < num_threads ? segment_size : file_size - offset;
+
+            try {
+                segment_crcs[index] = _crc_file_segment(params, file_path, offset, segment_sizes[index]);
+            }
+            catch (...) {
+                segment_errors[index] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+
+        for (size_t i = 1; i < num_threads; i++) {
+            try {
+                threads.emplace_back(process_segment, i);
+            }
+            catch (const std::system_error &) {
+                // out of the thread resources, the rest of the segments are processed by the calling thread
+                for (; i < num_threads; i++) {
+                    process_segment(i);
+                }
+            }
+        }
+
+        process_segment(0);
+
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        for (const auto & segment_error : segment_errors) {
+            if (segment_error) {
+                std::rethrow_exception(segment_error);
+            }
+        }
+
+        uint64_t file_crc = segment_crcs[0];
+
+        for (size_t i = 1; i < num_threads; i++) {
+            file_crc = crc_combine(width, polynomial, file_crc, segment_crcs[i], segment_sizes[i], crc_init, xor_in, xor_out, result_reflected);
+        }
+
+        return file_crc;
+    }
+}
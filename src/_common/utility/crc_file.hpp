@@ -0,0 +1,22 @@
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+#include <utility/crc.hpp>
+
+#include <string>
+#include <cstdint>
+
+
+namespace utility
+{
+    // Computes the crc of a whole file by `crc` parameters:
+    //  the file is splitted into `num_threads` contiguous segments (by the hardware concurrency if 0), where each thread
+    //  reads its segment through its own file handle from the segment offset and the segment crcs are merged by
+    //  `crc_combine` in the file order. Small files are read by less threads.
+    //
+    uint64_t crc_file(size_t width, uint64_t polynomial, const std::string & file_path, uint64_t crc_init = uint64_t(~0ULL),
+        uint64_t xor_in = 0U, uint64_t xor_out = uint64_t(~0ULL), bool input_reflected = false, bool result_reflected = false,
+        size_t num_threads = 0, CrcKernel kernel = crc_kernel_auto);
+}
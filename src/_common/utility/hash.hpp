@@ -1,18 +1,18 @@
-#pragma once
-
-#include <tacklelib.hpp>
-
-#include <utility/platform.hpp>
-
-#include <boost/functional/hash.hpp>
-
-
-namespace utility
-{
-    template <class T>
-    FORCE_INLINE void hash_combine(std::size_t & seed, const T & v)
-    {
-        boost::hash<T> hasher;
-        seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-}
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+
+#include <boost/functional/hash.hpp>
+
+
+namespace utility
+{
+    template <class T>
+    FORCE_INLINE void hash_combine(std::size_t & seed, const T & v)
+    {
+        boost::hash<T> hasher;
+        seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+}
@@ -0,0 +1,380 @@
+#include "main.hpp"
+
+#include "utility/utility.hpp"
+#include "utility/crc.hpp"
+#include "utility/crc_file.hpp"
+#include "utility/assert.hpp"
+
+#include "tackle/file_reader.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(UTILITY_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace po = boost::program_options;
+using namespace utility;
+
+namespace boost {
+    namespace fs = filesystem;
+}
+
+namespace
+{
+    // crc parameters in the catalogue (Rocksoft) form, where the initial value is of the not reflected register if the
+    // input is not reflected
+    struct CrcAlgorithm
+    {
+        const char *    name;
+        size_t          width;
+        uint64_t        polynomial;
+        uint64_t        crc_init;
+        bool            input_reflected;
+        bool            result_reflected;
+        uint64_t        xor_out;
+    };
+
+    const CrcAlgorithm s_crc_algorithms[] = {
+        { "crc16-arc",          16, 0x8005,             0x0000,             true,   true,   0x0000 },
+        { "crc16-ccitt-false",  16, 0x1021,             0xFFFF,             false,  false,  0x0000 },
+        { "crc16-kermit",       16, 0x1021,             0x0000,             true,   true,   0x0000 },
+        { "crc16-modbus",       16, 0x8005,             0xFFFF,             true,   true,   0x0000 },
+        { "crc16-xmodem",       16, 0x1021,             0x0000,             false,  false,  0x0000 },
+        { "crc24-openpgp",      24, 0x864CFB,           0xB704CE,           false,  false,  0x000000 },
+        { "crc32",              32, 0x04C11DB7,         0xFFFFFFFF,         true,   true,   0xFFFFFFFF },
+        { "crc32-bzip2",        32, 0x04C11DB7,         0xFFFFFFFF,         false,  false,  0xFFFFFFFF },
+        { "crc32-mpeg2",        32, 0x04C11DB7,         0xFFFFFFFF,         false,  false,  0x00000000 },
+        { "crc32c",             32, 0x1EDC6F41,         0xFFFFFFFF,         true,   true,   0xFFFFFFFF },
+        { "crc64-ecma",         64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false,  false,  0x0000000000000000 },
+        { "crc64-xz",           64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, true,   true,   0xFFFFFFFFFFFFFFFF },
+    };
+
+    const char * s_crc_kernel_names[] = { "auto", "table", "slice8", "slice16", "pclmul", "crc32c" };
+
+    // maximum size of a read chunk
+    const size_t s_max_read_chunk_size = 4 * 1024 * 1024;
+
+    enum TrailerOrder
+    {
+        trailer_none = 0,
+        trailer_little_endian,
+        trailer_big_endian
+    };
+
+    struct UserData
+    {
+        CrcContext *            crc_context;
+        size_t                  trailer_size;
+        std::vector<uint8_t>    trailer;    // last `trailer_size` bytes, which are not processed yet
+    };
+
+    uint64_t _reflect_crc_value(uint64_t value, size_t width)
+    {
+        uint64_t reflected_value = 0;
+        for (size_t i = 0; i < width; i++) {
+            reflected_value = (reflected_value << 1) | ((value >> i) & 0x01);
+        }
+        return reflected_value;
+    }
+
+    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+        const size_t trailer_size = data.trailer_size;
+
+        if (!trailer_size) {
+            data.crc_context->update(buf, read_size);
+            return;
+        }
+
+        // the trailer is held back until the next chunk or the end of the input
+        std::vector<uint8_t> & trailer = data.trailer;
+
+        if (read_size >= trailer_size) {
+            data.crc_context->update(trailer.data(), trailer.size());
+            data.crc_context->update(buf, read_size - trailer_size);
+            trailer.assign(buf + read_size - trailer_size, buf + read_size);
+        }
+        else {
+            trailer.insert(trailer.end(), buf, buf + read_size);
+            if (trailer.size() > trailer_size) {
+                const size_t processed_size = trailer.size() - trailer_size;
+                data.crc_context->update(trailer.data(), processed_size);
+                trailer.erase(trailer.begin(), trailer.begin() + processed_size);
+            }
+        }
+    }
+
+    void _read_stdin(UserData & user_data)
+    {
+#if defined(UTILITY_PLATFORM_WINDOWS)
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+        // the standard input is not seekable, so it is read by the fixed size chunks instead of the `FileReader`
+        std::vector<uint8_t> buf(s_max_read_chunk_size);
+
+        size_t read_size;
+        while ((read_size = fread(&buf[0], 1, buf.size(), stdin)) > 0) {
+            _read_file_chunk(&buf[0], read_size, &user_data);
+        }
+
+        const int stdin_read_err = ferror(stdin);
+        if (stdin_read_err) {
+            utility::debug_break();
+            throw std::system_error{ stdin_read_err, std::system_category(), "stdin" };
+        }
+    }
+
+    std::string _format_crc(uint64_t crc, size_t width, const std::string & format)
+    {
+        if (format == "dec") {
+            return (boost::format("%llu") % crc).str();
+        }
+
+        return (boost::format((boost::format("%%0%uX") % uint32_t((width + 3) / 4)).str()) % crc).str();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        std::vector<std::string> in_files;
+        std::string algorithm_str = "crc32";
+        std::string width_str;
+        std::string polynomial_str;
+        std::string init_str;
+        std::string xor_out_str;
+        bool input_reflected = false;
+        bool result_reflected = false;
+        std::string kernel_str = "auto";
+        size_t num_threads = 1;
+        std::string format_str = "hex";
+        std::string trailer_str;
+
+        po::options_description desc("Allowed options");
+        desc.add_options()
+            ("help,h", "print usage message")
+            ("input,i",
+                po::value(&in_files), "input files, `-` or nothing to read the standard input")
+            ("algorithm,a",
+                po::value(&algorithm_str), "crc algorithm: crc16-arc, crc16-ccitt-false, crc16-kermit, crc16-modbus, crc16-xmodem, crc24-openpgp, crc32 (default), crc32-bzip2, crc32-mpeg2, crc32c, crc64-ecma, crc64-xz")
+            ("width,w",
+                po::value(&width_str), "custom crc width in the range [1, 64], replaces the algorithm")
+            ("polynomial,p",
+                po::value(&polynomial_str), "custom crc polynomial in the normal form without the highest term (ex: 0x04C11DB7)")
+            ("init",
+                po::value(&init_str), "custom crc initial value in the catalogue form (not reflected for the not reflected input)")
+            ("xor_out",
+                po::value(&xor_out_str), "custom crc final xor value")
+            ("input_reflected",
+                po::bool_switch(&input_reflected), "custom crc input is reflected (LSB first)")
+            ("result_reflected",
+                po::bool_switch(&result_reflected), "custom crc result is reflected")
+            ("kernel,k",
+                po::value(&kernel_str), "crc kernel: auto (default), table, slice8, slice16, pclmul, crc32c")
+            ("threads,t",
+                po::value(&num_threads), "number of threads per input file, 0 - by the hardware concurrency (only for a file without the trailer)")
+            ("format,f",
+                po::value(&format_str), "output format: hex (default), dec")
+            ("trailer",
+                po::value(&trailer_str), "verify the crc embedded at the input end in the byte order: little, big")
+        ;
+
+        po::positional_options_description p;
+        p.add("input", -1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
+        po::notify(vm); // important, otherwise related option variables won't be initialized
+
+        if (vm.count("help")) {
+            std::cout << desc << "\n";
+            return 0;
+        }
+
+        // algorithm
+
+        CrcAlgorithm algorithm = {};
+
+        if (width_str.empty()) {
+            const std::string name = boost::algorithm::to_lower_copy(boost::algorithm::trim_copy(algorithm_str));
+
+            const CrcAlgorithm * found_algorithm = nullptr;
+            for (const auto & crc_algorithm : s_crc_algorithms) {
+                if (name == crc_algorithm.name) {
+                    found_algorithm = &crc_algorithm;
+                    break;
+                }
+            }
+
+            if (!found_algorithm) {
+                fprintf(stderr, "error: unknown crc algorithm: \"%s\"\n", algorithm_str.c_str());
+                return 1;
+            }
+
+            algorithm = *found_algorithm;
+        }
+        else {
+            algorithm.width = std::stoul(width_str, 0, 0);
+            if (!algorithm.width || algorithm.width > 64) {
+                fprintf(stderr, "error: crc width is out of range [1, 64]: %u\n", uint32_t(algorithm.width));
+                return 2;
+            }
+
+            if (polynomial_str.empty()) {
+                fprintf(stderr, "error: crc polynomial is not set\n");
+                return 2;
+            }
+
+            algorithm.polynomial = std::stoull(polynomial_str, 0, 0);
+            algorithm.crc_init = !init_str.empty() ? std::stoull(init_str, 0, 0) : 0;
+            algorithm.xor_out = !xor_out_str.empty() ? std::stoull(xor_out_str, 0, 0) : 0;
+            algorithm.input_reflected = input_reflected;
+            algorithm.result_reflected = result_reflected;
+        }
+
+        const uint64_t crc_mask = algorithm.width < 64 ? (uint64_t(0x01) << algorithm.width) - 1 : uint64_t(~0ULL);
+
+        // the crc initial value is of the reflected register
+        const uint64_t crc_init = algorithm.input_reflected ?
+            algorithm.crc_init & crc_mask : _reflect_crc_value(algorithm.crc_init, algorithm.width);
+
+        // kernel
+
+        const std::string kernel_name = boost::algorithm::to_lower_copy(boost::algorithm::trim_copy(kernel_str));
+
+        const auto kernel_it = std::find(std::begin(s_crc_kernel_names), std::end(s_crc_kernel_names), kernel_name);
+        if (kernel_it == std::end(s_crc_kernel_names)) {
+            fprintf(stderr, "error: unknown crc kernel: \"%s\"\n", kernel_str.c_str());
+            return 3;
+        }
+
+        const CrcKernel kernel = CrcKernel(kernel_it - std::begin(s_crc_kernel_names));
+
+        // output
+
+        if (format_str != "hex" && format_str != "dec") {
+            fprintf(stderr, "error: unknown output format: \"%s\"\n", format_str.c_str());
+            return 4;
+        }
+
+        TrailerOrder trailer_order = trailer_none;
+        if (trailer_str == "little") {
+            trailer_order = trailer_little_endian;
+        }
+        else if (trailer_str == "big") {
+            trailer_order = trailer_big_endian;
+        }
+        else if (!trailer_str.empty()) {
+            fprintf(stderr, "error: unknown trailer byte order: \"%s\"\n", trailer_str.c_str());
+            return 4;
+        }
+
+        const size_t trailer_size = trailer_order != trailer_none ? (algorithm.width + CHAR_BIT - 1) / CHAR_BIT : 0;
+
+        if (in_files.empty()) {
+            in_files.push_back("-");
+        }
+
+        int ret = 0;
+
+        for (const auto & in_file : in_files) {
+            const bool is_stdin = (in_file == "-");
+
+            if (!is_stdin && !boost::fs::exists(in_file)) {
+                fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
+                ret = 5;
+                continue;
+            }
+
+            uint64_t crc;
+            std::vector<uint8_t> trailer;
+
+            if (!is_stdin && num_threads != 1 && !trailer_size) {
+                crc = crc_file(algorithm.width, algorithm.polynomial, in_file, crc_init, 0, algorithm.xor_out,
+                    algorithm.input_reflected, algorithm.result_reflected, num_threads, kernel);
+            }
+            else {
+                CrcContext crc_context(algorithm.width, algorithm.polynomial, crc_init, 0, algorithm.xor_out, algorithm.input_reflected,
+                    algorithm.result_reflected, kernel);
+
+                UserData user_data;
+                user_data.crc_context = &crc_context;
+                user_data.trailer_size = trailer_size;
+
+                if (is_stdin) {
+                    _read_stdin(user_data);
+                }
+                else {
+                    FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
+
+                    tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, s_max_read_chunk_size, s_max_read_chunk_size);
+                }
+
+                crc = crc_context.finalize();
+                trailer = user_data.trailer;
+            }
+
+            const std::string crc_str = _format_crc(crc, algorithm.width, format_str);
+
+            if (!trailer_size) {
+                printf("%s  %s\n", crc_str.c_str(), in_file.c_str());
+                continue;
+            }
+
+            if (trailer.size() < trailer_size) {
+                fprintf(stderr, "error: input is too small for the crc trailer: \"%s\"\n", in_file.c_str());
+                ret = 6;
+                continue;
+            }
+
+            uint64_t trailer_crc = 0;
+            for (size_t i = 0; i < trailer_size; i++) {
+                const size_t byte_index = trailer_order == trailer_little_endian ? trailer_size - i - 1 : i;
+                trailer_crc = (trailer_crc << CHAR_BIT) | trailer[byte_index];
+            }
+            trailer_crc &= crc_mask;
+
+            if (trailer_crc == crc) {
+                printf("%s  %s: OK\n", crc_str.c_str(), in_file.c_str());
+            }
+            else {
+                printf("%s  %s: FAILED (trailer %s)\n", crc_str.c_str(), in_file.c_str(), _format_crc(trailer_crc, algorithm.width, format_str).c_str());
+                ret = 7;
+            }
+        }
+
+        return ret;
+    }
+    catch (std::exception & e) {
+        std::cerr << e.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}
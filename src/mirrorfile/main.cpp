@@ -1,152 +1,404 @@
-#include "main.hpp"
-
-#include "utility/utility.hpp"
-#include "utility/assert.hpp"
-
-#include "tackle/file_reader.hpp"
-
-#include <boost/program_options.hpp>
-#include <boost/filesystem.hpp>
-
-#include <string>
-#include <iostream>
-#include <vector>
-#include <algorithm>
-
-#include <stdio.h>
-#include <stdlib.h>
-
-namespace po = boost::program_options;
-using namespace utility;
-
-namespace boost {
-    namespace fs = filesystem;
-}
-
-namespace
-{
-    struct UserData
-    {
-        size_t byte_width;
-        FileHandle file_out_handle;
-    };
-
-    void mirror_buffer(uint8_t * buf, uint32_t byte_width)
-    {
-        ASSERT_TRUE(buf && byte_width);
-        // reverse bits in bytes
-        for (size_t i = 0; i < byte_width; i++) {
-            buf[i] = utility::reverse(buf[i]);
-        }
-        // reverse bytes
-        std::reverse(buf, buf + byte_width);
-    }
-
-    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
-    {
-        if (sizeof(size_t) < sizeof(uint64_t)) {
-            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
-            if (size > max_value) {
-                throw std::runtime_error(
-                    (boost::format(
-                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
-                            size).str());
-            }
-        }
-
-        const UserData & data = *static_cast<UserData *>(user_data);
-
-        const size_t read_size = uint32_t(size);
-
-        if (read_size < data.byte_width) {
-            memmove(&buf[data.byte_width - read_size], buf, read_size);
-            memset(buf, 0, data.byte_width - read_size);
-        }
-
-        mirror_buffer(buf, data.byte_width);
-
-        const size_t write_size = fwrite(buf, 1, data.byte_width, data.file_out_handle.get());
-        const int file_write_err = ferror(data.file_out_handle.get());
-        if (write_size < data.byte_width) {
-            utility::debug_break();
-            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
-        }
-    }
-}
-
-int main(int argc, char* argv[])
-{
-    try {
-        std::string in_file;
-        std::string out_file;
-        std::string byte_width_str;
-
-        po::options_description desc("Allowed options");
-        desc.add_options()
-            ("help,h", "print usage message")
-            ("input,i",
-                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
-            ("output,o",
-                po::value(&out_file), "output file")
-            ("byte_width,b",
-                po::value(&byte_width_str), "byte width of the file stream to mirror")
-        ;
-
-        po::positional_options_description p;
-        p.add("input", 1);
-        p.add("byte_width", 1);
-
-        po::variables_map vm;
-        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
-        po::notify(vm); // important, otherwise related option variables won't be initialized
-
-        if (vm.count("help")) {
-            std::cout << desc << "\n";
-            return 0;
-        }
-
-        if (!boost::fs::exists(in_file)) {
-            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
-            return 1;
-        }
-
-        if (in_file == out_file) {
-            fprintf(stderr, "error: output file should not be input\n");
-            return 2;
-        }
-
-        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
-
-        boost::fs::path in_file_path = boost::fs::path(in_file);
-
-        if (out_file.empty()) {
-            const std::string & out_parent_path = in_file_path.parent_path().string();
-            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_mirror" + in_file_path.extension().string();
-        }
-
-        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
-
-        typedef std::shared_ptr<uint8_t> ReadBufSharedPtr;
-
-        std::vector<uint8_t> row = { 0xff, 0xff, 0xff, 0xff };
-        uint32_t byte_width = 32; // 256 bits
-        if (!byte_width_str.empty()) {
-            byte_width = std::stoul(byte_width_str, 0, 0);
-        }
-        // maximum
-        if (byte_width > 1024 * 1024) {
-            byte_width = 1024 * 1024;
-        }
-
-        UserData user_data;
-        user_data.byte_width = byte_width;
-        user_data.file_out_handle = file_out_handle;
-        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, byte_width, byte_width);
-    }
-    catch (std::exception & e) {
-        std::cerr << e.what() << "\n";
-        return -1;
-    }
-
-    return 0;
-}
+#include "main.hpp"
+
+#include "utility/utility.hpp"
+#include "utility/bits.hpp"
+#include "utility/assert.hpp"
+
+#include "tackle/file_reader.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace po = boost::program_options;
+using namespace utility;
+
+namespace boost {
+    namespace fs = filesystem;
+}
+
+namespace
+{
+    enum Mode
+    {
+        mode_mirror,    // reverse bytes and bits in each row
+        mode_bytes,     // reverse bytes in each row
+        mode_bits       // reverse bits in each byte
+    };
+
+    struct UserData
+    {
+        Mode mode;
+        size_t byte_width;
+        size_t bit_width;
+        size_t stride;          // record size: header, row payload of the byte width and the rest
+        size_t header_size;     // bytes before the row payload in a record
+        utility::MirrorRowsFunc mirror_rows_func;
+        FileHandle file_out_handle;
+        std::vector<uint8_t> out_buf;
+    };
+
+    // maximum size of a read chunk, rounded down to a multiple of the row or the record
+    const size_t s_max_read_chunk_size = 4 * 1024 * 1024;
+
+    void _process_rows(const UserData & data, uint8_t * buf, size_t num_rows, size_t stride)
+    {
+        switch (data.mode) {
+        case mode_bytes:
+            if (stride == data.byte_width) {
+                // the byte swap has no cross row moves, so the whole batch is swapped in one call
+                utility::swap_bytes(buf, num_rows * data.byte_width, data.byte_width);
+            }
+            else {
+                for (size_t i = 0; i < num_rows; i++) {
+                    utility::swap_bytes(buf + i * stride, data.byte_width, data.byte_width);
+                }
+            }
+            break;
+        default:
+            // reverse bytes and bits in bytes in the same pass
+            data.mirror_rows_func(buf, num_rows, data.byte_width, stride);
+        }
+    }
+
+    void _write_file_chunk(const UserData & data, const uint8_t * buf, size_t size)
+    {
+        const size_t write_size = fwrite(buf, 1, size, data.file_out_handle.get());
+        const int file_write_err = ferror(data.file_out_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
+        }
+    }
+
+    void _read_bits_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        const UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+
+        // no rows, each byte is processed in place
+        utility::reverse_bits_in_bytes(buf, read_size);
+
+        _write_file_chunk(data, buf, read_size);
+    }
+
+    void _read_reverse_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        const UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+
+        // chunks come from the file end, so the mirrored chunks are written in the reversed file order
+        utility::mirror_bits(buf, read_size);
+
+        _write_file_chunk(data, buf, read_size);
+    }
+
+    void _read_bit_rows_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+
+        // the chunk is a multiple of 8 rows except the last one, so each chunk begins at a byte boundary
+        const uint64_t read_bit_size = uint64_t(read_size) * CHAR_BIT;
+        const size_t num_rows = size_t(read_bit_size / data.bit_width);
+        const size_t last_row_bit_size = size_t(read_bit_size % data.bit_width);
+
+        // mirrored rows are or'ed into the zeroed output buffer, plus the padded last row and the word spill
+        data.out_buf.assign(read_size + (data.bit_width + CHAR_BIT - 1) / CHAR_BIT + 16, 0);
+
+        utility::mirror_bit_rows(buf, read_size, &data.out_buf[0], num_rows, data.bit_width);
+
+        uint64_t write_bit_size = uint64_t(num_rows) * data.bit_width;
+
+        if (last_row_bit_size) {
+            // the short last row is padded by zeros at the row beginning, so the mirrored row ends by zeros
+            utility::mirror_bit_range(buf, read_size, write_bit_size, &data.out_buf[0], write_bit_size, last_row_bit_size);
+            write_bit_size += data.bit_width;
+        }
+
+        const size_t write_size = size_t((write_bit_size + CHAR_BIT - 1) / CHAR_BIT);
+        if (write_size) {
+            _write_file_chunk(data, &data.out_buf[0], write_size);
+        }
+    }
+
+    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        const UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+
+        // the chunk is a multiple of the record except the last one
+        const size_t num_rows = read_size / data.stride;
+        const size_t last_row_size = read_size % data.stride;
+
+        // only the payload of a record is processed, the header and the rest of the record are copied through
+        _process_rows(data, buf + data.header_size, num_rows, data.stride);
+
+        const size_t payload_end = data.header_size + data.byte_width;
+
+        if (last_row_size >= payload_end) {
+            // the short last record has the whole payload
+            _process_rows(data, buf + num_rows * data.stride + data.header_size, 1, data.stride);
+            _write_file_chunk(data, buf, read_size);
+        }
+        else {
+            if (num_rows) {
+                _write_file_chunk(data, buf, num_rows * data.stride);
+            }
+
+            if (last_row_size > data.header_size) {
+                // the short last row is padded by zeros at the row beginning
+                const uint8_t * last_row = buf + num_rows * data.stride;
+                const size_t last_payload_size = last_row_size - data.header_size;
+
+                std::vector<uint8_t> row(payload_end);
+                memcpy(&row[0], last_row, data.header_size);
+                memcpy(&row[payload_end - last_payload_size], last_row + data.header_size, last_payload_size);
+
+                _process_rows(data, &row[data.header_size], 1, data.byte_width);
+
+                _write_file_chunk(data, &row[0], payload_end);
+            }
+            else if (last_row_size) {
+                _write_file_chunk(data, buf + num_rows * data.stride, last_row_size);
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        std::string in_file;
+        std::string out_file;
+        std::string byte_width_str;
+        std::string bit_width_str;
+        std::string mode_str;
+        std::string stride_str;
+        std::string header_str;
+        bool reverse = false;
+
+        po::options_description desc("Allowed options");
+        desc.add_options()
+            ("help,h", "print usage message")
+            ("input,i",
+                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
+            ("output,o",
+                po::value(&out_file), "output file")
+            ("byte_width,b",
+                po::value(&byte_width_str), "byte width of the file stream to mirror")
+            ("bit_width,w",
+                po::value(&bit_width_str), "bit width of the file stream to mirror, rows are packed back to back from the most significant bit of a byte (overrides byte width)")
+            ("mode,m",
+                po::value(&mode_str), "mirror mode: `mirror` (default) - reverse bytes and bits in each row, `bytes` - reverse bytes in each row (byte width is the word size to swap), `bits` - reverse bits in each byte (byte width is ignored)")
+            ("stride,s",
+                po::value(&stride_str), "record size of a row, only the row payload of the byte width is mirrored and the rest of the record is copied through (byte width plus header by default)")
+            ("header",
+                po::value(&header_str), "byte size of a record header before the row payload, copied through")
+            ("reverse,r",
+                po::bool_switch(&reverse), "mirror the whole file instead of rows, the last bit becomes the first (byte width is ignored)")
+        ;
+
+        po::positional_options_description p;
+        p.add("input", 1);
+        p.add("byte_width", 1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
+        po::notify(vm); // important, otherwise related option variables won't be initialized
+
+        if (vm.count("help")) {
+            std::cout << desc << "\n";
+            return 0;
+        }
+
+        if (!boost::fs::exists(in_file)) {
+            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
+            return 1;
+        }
+
+        if (in_file == out_file) {
+            fprintf(stderr, "error: output file should not be input\n");
+            return 2;
+        }
+
+        Mode mode = mode_mirror;
+        if (!mode_str.empty()) {
+            if (mode_str == "bytes") {
+                mode = mode_bytes;
+            }
+            else if (mode_str == "bits") {
+                mode = mode_bits;
+            }
+            else if (mode_str != "mirror") {
+                fprintf(stderr, "error: unknown mode: \"%s\"\n", mode_str.c_str());
+                return 4;
+            }
+        }
+
+        if (mode != mode_mirror && (reverse || !bit_width_str.empty())) {
+            fprintf(stderr, "error: reverse and bit width options are applicable only to the mirror mode\n");
+            return 5;
+        }
+
+        if ((!stride_str.empty() || !header_str.empty()) && (reverse || !bit_width_str.empty() || mode == mode_bits)) {
+            fprintf(stderr, "error: stride and header options are applicable only to the byte width rows\n");
+            return 6;
+        }
+
+        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
+
+        boost::fs::path in_file_path = boost::fs::path(in_file);
+
+        if (out_file.empty()) {
+            const std::string & out_parent_path = in_file_path.parent_path().string();
+            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_mirror" + in_file_path.extension().string();
+        }
+
+        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
+
+        typedef std::shared_ptr<uint8_t> ReadBufSharedPtr;
+
+        uint32_t byte_width = 32; // 256 bits
+        if (!byte_width_str.empty()) {
+            byte_width = std::stoul(byte_width_str, 0, 0);
+            if (!byte_width) {
+                fprintf(stderr, "error: byte width should not be zero\n");
+                return 3;
+            }
+        }
+        // maximum
+        if (byte_width > 1024 * 1024) {
+            byte_width = 1024 * 1024;
+        }
+
+        uint32_t bit_width = 0;
+        if (!bit_width_str.empty()) {
+            bit_width = std::stoul(bit_width_str, 0, 0);
+            if (!bit_width) {
+                fprintf(stderr, "error: bit width should not be zero\n");
+                return 3;
+            }
+            // maximum
+            if (bit_width > 8 * 1024 * 1024) {
+                bit_width = 8 * 1024 * 1024;
+            }
+            // byte aligned rows has faster in place mirror
+            if (!(bit_width % CHAR_BIT)) {
+                byte_width = bit_width / CHAR_BIT;
+                bit_width = 0;
+            }
+        }
+
+        uint32_t header_size = 0;
+        if (!header_str.empty()) {
+            header_size = std::stoul(header_str, 0, 0);
+        }
+
+        uint32_t stride = byte_width + header_size;
+        if (!stride_str.empty()) {
+            stride = std::stoul(stride_str, 0, 0);
+        }
+
+        if (uint64_t(header_size) + byte_width > stride) {
+            fprintf(stderr, "error: stride should not be less than the header plus the byte width: stride=%u header=%u byte_width=%u\n",
+                stride, header_size, byte_width);
+            return 7;
+        }
+
+        // maximum
+        if (stride > 64 * 1024 * 1024) {
+            fprintf(stderr, "error: stride should not be greater than 64MB: stride=%u\n", stride);
+            return 8;
+        }
+
+        UserData user_data;
+        user_data.mode = mode;
+        user_data.byte_width = byte_width;
+        user_data.bit_width = bit_width;
+        user_data.stride = stride;
+        user_data.header_size = header_size;
+        // the kernel of the row width is selected once
+        user_data.mirror_rows_func = utility::get_mirror_rows_func(byte_width);
+        user_data.file_out_handle = file_out_handle;
+
+        if (reverse) {
+            // single streaming pass from the file end with bounded memory
+            tackle::FileReader(file_in_handle, _read_reverse_file_chunk).do_read_backward(&user_data, s_max_read_chunk_size);
+            return 0;
+        }
+
+        if (mode == mode_bits) {
+            tackle::FileReader(file_in_handle, _read_bits_file_chunk).do_read(&user_data, {}, s_max_read_chunk_size, s_max_read_chunk_size);
+            return 0;
+        }
+
+        if (bit_width) {
+            // 8 rows is the least multiple of the row at a byte boundary
+            const uint32_t max_read_size = uint32_t((std::max)(s_max_read_chunk_size / bit_width, size_t(1)) * bit_width);
+            tackle::FileReader(file_in_handle, _read_bit_rows_file_chunk).do_read(&user_data, {}, max_read_size, max_read_size);
+            return 0;
+        }
+
+        // read thousands of rows per call instead of a row per call
+        const uint32_t max_read_size = uint32_t((std::max)(s_max_read_chunk_size / stride, size_t(1)) * stride);
+        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, stride, max_read_size);
+    }
+    catch (std::exception & e) {
+        std::cerr << e.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,296 @@
+#include "main.hpp"
+
+#include "utility/utility.hpp"
+#include "utility/bits.hpp"
+#include "utility/assert.hpp"
+
+#include "tackle/file_reader.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace po = boost::program_options;
+using namespace utility;
+
+namespace boost {
+    namespace fs = filesystem;
+}
+
+namespace
+{
+    struct UserData
+    {
+        bool bits;
+        size_t word_size;
+        utility::BytePermutation byte_permutation;
+        utility::BitPermutation bit_permutation;
+        FileHandle file_out_handle;
+    };
+
+    // maximum size of a read chunk, rounded down to a multiple of the permutation period
+    const size_t s_max_read_chunk_size = 4 * 1024 * 1024;
+
+    // Parses the permutation spec of a word of bytes or bits:
+    //  `3,1,2,0`       - output unit `i` is the input unit of the index `i` in the list, the list length is the word size
+    //  `reverse`       - reverse units of a word of the width
+    //  `swap halves`   - swap halves of a word of the width
+    //  `swap pairs`    - swap units in each pair of units of a word of the width
+    //
+    bool parse_permutation(const std::string & spec, uint32_t width, std::vector<uint8_t> & indexes)
+    {
+        std::string name = boost::algorithm::to_lower_copy(boost::algorithm::trim_copy(spec));
+        std::replace(name.begin(), name.end(), '_', ' ');
+
+        indexes.clear();
+
+        if (name == "reverse") {
+            for (uint32_t i = 0; i < width; i++) {
+                indexes.push_back(uint8_t(width - i - 1));
+            }
+            return true;
+        }
+        if (name == "swap halves") {
+            if (width % 2) {
+                return false;
+            }
+            for (uint32_t i = 0; i < width; i++) {
+                indexes.push_back(uint8_t((i + width / 2) % width));
+            }
+            return true;
+        }
+        if (name == "swap pairs") {
+            if (width % 2) {
+                return false;
+            }
+            for (uint32_t i = 0; i < width; i++) {
+                indexes.push_back(uint8_t(i ^ 1));
+            }
+            return true;
+        }
+
+        std::vector<std::string> tokens;
+        boost::algorithm::split(tokens, name, boost::algorithm::is_any_of(", "), boost::algorithm::token_compress_on);
+
+        for (const auto & token : tokens) {
+            if (token.empty()) continue;
+            unsigned long index;
+            try {
+                index = std::stoul(token, 0, 0);
+            }
+            catch (const std::invalid_argument &) {
+                return false;
+            }
+            catch (const std::out_of_range &) {
+                return false;
+            }
+            if (index > 255) {
+                return false;
+            }
+            indexes.push_back(uint8_t(index));
+        }
+
+        return !indexes.empty();
+    }
+
+    // each unit of a word is selected once, otherwise it is a gather instead of a permutation
+    bool is_word_permutation(const std::vector<uint8_t> & indexes)
+    {
+        std::vector<bool> used(indexes.size());
+
+        for (auto index : indexes) {
+            if (index >= indexes.size() || used[index]) {
+                return false;
+            }
+            used[index] = true;
+        }
+
+        return true;
+    }
+
+    void _write_file_chunk(const UserData & data, const uint8_t * buf, size_t size)
+    {
+        const size_t write_size = fwrite(buf, 1, size, data.file_out_handle.get());
+        const int file_write_err = ferror(data.file_out_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
+        }
+    }
+
+    void _permute(const UserData & data, uint8_t * buf, size_t size)
+    {
+        if (data.bits) {
+            utility::permute_bits(buf, size, data.bit_permutation);
+        }
+        else {
+            utility::permute_bytes(buf, size, data.byte_permutation);
+        }
+    }
+
+    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        const UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+        const size_t word_size = data.word_size;
+
+        // the chunk is a multiple of the word except the last one
+        const size_t num_words_size = read_size / word_size * word_size;
+        const size_t last_word_size = read_size % word_size;
+
+        _permute(data, buf, num_words_size);
+
+        if (num_words_size) {
+            _write_file_chunk(data, buf, num_words_size);
+        }
+
+        if (last_word_size) {
+            // the short last word is padded by zeros at the word end
+            std::vector<uint8_t> word(word_size);
+            memcpy(&word[0], buf + num_words_size, last_word_size);
+
+            _permute(data, &word[0], word_size);
+
+            _write_file_chunk(data, &word[0], word_size);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        std::string in_file;
+        std::string out_file;
+        std::string byte_width_str;
+        std::string permutation_str;
+        bool bits = false;
+
+        po::options_description desc("Allowed options");
+        desc.add_options()
+            ("help,h", "print usage message")
+            ("input,i",
+                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
+            ("output,o",
+                po::value(&out_file), "output file")
+            ("permutation,p",
+                po::value(&permutation_str), "byte permutation of a word: list of input byte indexes for each output byte (`3,1,2,0`), or `reverse`, `swap halves`, `swap pairs` for a word of the byte width")
+            ("bits",
+                po::bool_switch(&bits), "the permutation is of bits of a 8/16/32/64-bit little endian word, the bit 0 is the least significant bit")
+            ("byte_width,b",
+                po::value(&byte_width_str), "byte width of a word for the named permutation, the length of the index list if set")
+        ;
+
+        po::positional_options_description p;
+        p.add("input", 1);
+        p.add("permutation", 1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
+        po::notify(vm); // important, otherwise related option variables won't be initialized
+
+        if (vm.count("help")) {
+            std::cout << desc << "\n";
+            return 0;
+        }
+
+        if (!boost::fs::exists(in_file)) {
+            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
+            return 1;
+        }
+
+        if (in_file == out_file) {
+            fprintf(stderr, "error: output file should not be input\n");
+            return 2;
+        }
+
+        uint32_t byte_width = 4;
+        if (!byte_width_str.empty()) {
+            byte_width = std::stoul(byte_width_str, 0, 0);
+        }
+        if (!byte_width || byte_width > 256) {
+            fprintf(stderr, "error: byte width is out of range [1, 256]: %u\n", byte_width);
+            return 3;
+        }
+
+        if (bits && byte_width != 1 && byte_width != 2 && byte_width != 4 && byte_width != 8) {
+            fprintf(stderr, "error: byte width of the bit permutation should be 1, 2, 4 or 8: %u\n", byte_width);
+            return 3;
+        }
+
+        std::vector<uint8_t> indexes;
+        if (!parse_permutation(permutation_str, bits ? byte_width * CHAR_BIT : byte_width, indexes)) {
+            fprintf(stderr, "error: invalid permutation: \"%s\"\n", permutation_str.c_str());
+            return 4;
+        }
+
+        if (!byte_width_str.empty() && indexes.size() != (bits ? byte_width * CHAR_BIT : byte_width)) {
+            fprintf(stderr, "error: permutation length should be the %s: length=%u byte_width=%u\n",
+                bits ? "bit width" : "byte width", uint32_t(indexes.size()), byte_width);
+            return 4;
+        }
+
+        if (bits && indexes.size() != 8 && indexes.size() != 16 && indexes.size() != 32 && indexes.size() != 64) {
+            fprintf(stderr, "error: bit permutation length should be 8, 16, 32 or 64: length=%u\n", uint32_t(indexes.size()));
+            return 4;
+        }
+
+        if (!is_word_permutation(indexes)) {
+            fprintf(stderr, "error: permutation should select each index of the word once: \"%s\"\n", permutation_str.c_str());
+            return 4;
+        }
+
+        UserData user_data;
+        user_data.bits = bits;
+        if (bits) {
+            user_data.bit_permutation = utility::compile_bit_permutation(indexes);
+            user_data.word_size = user_data.bit_permutation.word_size;
+        }
+        else {
+            user_data.byte_permutation = utility::compile_byte_permutation(indexes);
+            user_data.word_size = user_data.byte_permutation.word_size;
+        }
+
+        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
+
+        boost::fs::path in_file_path = boost::fs::path(in_file);
+
+        if (out_file.empty()) {
+            const std::string & out_parent_path = in_file_path.parent_path().string();
+            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_permute" + in_file_path.extension().string();
+        }
+
+        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
+
+        user_data.file_out_handle = file_out_handle;
+
+        const size_t period_size = !bits && user_data.byte_permutation.period_size ? user_data.byte_permutation.period_size : user_data.word_size;
+        const uint32_t max_read_size = uint32_t((std::max)(s_max_read_chunk_size / period_size, size_t(1)) * period_size);
+        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, max_read_size, max_read_size);
+    }
+    catch (std::exception & e) {
+        std::cerr << e.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}
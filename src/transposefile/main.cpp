@@ -0,0 +1,210 @@
+#include "main.hpp"
+
+#include "utility/utility.hpp"
+#include "utility/bits.hpp"
+#include "utility/assert.hpp"
+
+#include "tackle/file_reader.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace po = boost::program_options;
+using namespace utility;
+
+namespace boost {
+    namespace fs = filesystem;
+}
+
+namespace
+{
+    struct UserData
+    {
+        size_t byte_width;
+        uint64_t out_row_size;          // bytes of an output row (a bit column of all input rows)
+        bool single_band;               // all rows are in one band, the output is written sequentially
+        uint64_t band_row;              // first input row of the current band
+        std::vector<uint8_t> in_buf;    // the last band padded by zero rows
+        std::vector<uint8_t> out_buf;   // bit columns of the band
+        FileHandle file_out_handle;
+    };
+
+    // maximum size of a band of input rows, the output band is of the same size
+    const size_t s_max_band_size = 64 * 1024 * 1024;
+
+    void _write_file_chunk(const UserData & data, const uint8_t * buf, size_t size)
+    {
+        const size_t write_size = fwrite(buf, 1, size, data.file_out_handle.get());
+        const int file_write_err = ferror(data.file_out_handle.get());
+        if (write_size < size) {
+            utility::debug_break();
+            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
+        }
+    }
+
+    void _seek_file(const UserData & data, uint64_t offset)
+    {
+        if (_fseeki64(data.file_out_handle.get(), int64_t(offset), SEEK_SET)) {
+            utility::debug_break();
+            throw std::system_error{ ferror(data.file_out_handle.get()), std::system_category(), data.file_out_handle.path() };
+        }
+    }
+
+    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                            size).str());
+            }
+        }
+
+        UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = size_t(size);
+
+        // the short last row is padded by zeros at the row end, and the rows are padded by zero rows up to a byte of a column
+        const size_t num_rows = (read_size + data.byte_width - 1) / data.byte_width;
+        const size_t num_padded_rows = (num_rows + CHAR_BIT - 1) / CHAR_BIT * CHAR_BIT;
+
+        const uint8_t * in_buf = buf;
+        if (num_padded_rows * data.byte_width != read_size) {
+            data.in_buf.assign(num_padded_rows * data.byte_width, 0);
+            memcpy(&data.in_buf[0], buf, read_size);
+            in_buf = &data.in_buf[0];
+        }
+
+        const size_t num_columns = data.byte_width * CHAR_BIT;
+        const size_t column_size = num_padded_rows / CHAR_BIT;
+
+        data.out_buf.resize(num_columns * column_size);
+
+        utility::transpose_bit_matrix(in_buf, num_padded_rows, data.byte_width, &data.out_buf[0], column_size);
+
+        if (data.single_band) {
+            _write_file_chunk(data, &data.out_buf[0], data.out_buf.size());
+        }
+        else {
+            // scattered write of the band into each output row
+            const uint64_t band_offset = data.band_row / CHAR_BIT;
+            for (size_t i = 0; i < num_columns; i++) {
+                _seek_file(data, i * data.out_row_size + band_offset);
+                _write_file_chunk(data, &data.out_buf[i * column_size], column_size);
+            }
+        }
+
+        data.band_row += num_rows;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        std::string in_file;
+        std::string out_file;
+        std::string byte_width_str;
+
+        po::options_description desc("Allowed options");
+        desc.add_options()
+            ("help,h", "print usage message")
+            ("input,i",
+                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
+            ("output,o",
+                po::value(&out_file), "output file")
+            ("byte_width,b",
+                po::value(&byte_width_str), "byte width of the file stream rows, the output row is a bit column of all input rows")
+        ;
+
+        po::positional_options_description p;
+        p.add("input", 1);
+        p.add("byte_width", 1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
+        po::notify(vm); // important, otherwise related option variables won't be initialized
+
+        if (vm.count("help")) {
+            std::cout << desc << "\n";
+            return 0;
+        }
+
+        if (!boost::fs::exists(in_file)) {
+            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
+            return 1;
+        }
+
+        if (in_file == out_file) {
+            fprintf(stderr, "error: output file should not be input\n");
+            return 2;
+        }
+
+        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
+
+        boost::fs::path in_file_path = boost::fs::path(in_file);
+
+        if (out_file.empty()) {
+            const std::string & out_parent_path = in_file_path.parent_path().string();
+            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_transpose" + in_file_path.extension().string();
+        }
+
+        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
+
+        uint32_t byte_width = 32; // 256 bits
+        if (!byte_width_str.empty()) {
+            byte_width = std::stoul(byte_width_str, 0, 0);
+        }
+        if (!byte_width) {
+            fprintf(stderr, "error: byte width should not be zero\n");
+            return 3;
+        }
+        // maximum
+        if (byte_width > 1024 * 1024) {
+            byte_width = 1024 * 1024;
+        }
+
+        const uint64_t file_in_size = utility::get_file_size(file_in_handle);
+        if (!file_in_size) {
+            return 0;
+        }
+
+        const uint64_t num_rows = (file_in_size + byte_width - 1) / byte_width;
+
+        // the band is a multiple of 64 rows, so each band begins at a 64-bit boundary of the output rows
+        const size_t band_num_rows = (std::max)(s_max_band_size / byte_width / 64, size_t(1)) * 64;
+        const uint32_t max_read_size = uint32_t(band_num_rows * byte_width);
+
+        UserData user_data;
+        user_data.byte_width = byte_width;
+        user_data.out_row_size = (num_rows + CHAR_BIT - 1) / CHAR_BIT;
+        user_data.single_band = (num_rows <= band_num_rows);
+        user_data.band_row = 0;
+        user_data.file_out_handle = file_out_handle;
+
+        if (!user_data.single_band) {
+            // presize the output file for the scattered writes
+            const uint8_t zero = 0;
+            _seek_file(user_data, user_data.out_row_size * byte_width * CHAR_BIT - 1);
+            _write_file_chunk(user_data, &zero, 1);
+        }
+
+        // bounded memory: the input band, the output band and the reader buffer
+        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, max_read_size, max_read_size);
+    }
+    catch (std::exception & e) {
+        std::cerr << e.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}
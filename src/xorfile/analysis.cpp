@@ -0,0 +1,368 @@
+#include "analysis.hpp"
+
+#include <utility/utility.hpp>
+#include <utility/assert.hpp>
+
+#include <tackle/file_reader.hpp>
+
+#include <boost/format.hpp>
+#include <boost/preprocessor/cat.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+#include <stdio.h>
+
+
+namespace
+{
+    // the period detection does not need the whole file, the file beginning is enough for the statistics
+    const size_t s_max_period_sample_size = 64 * 1024 * 1024;
+
+    const size_t s_max_read_chunk_size = 64 * 1024 * 1024;
+
+    // calls `func(thread_index, begin, end)` for `num_threads` contiguous ranges of `[0, size)` in parallel
+    template <typename F>
+    void _parallel_for_ranges(size_t size, size_t num_threads, F && func)
+    {
+        num_threads = (std::max)((std::min)(num_threads, size), size_t(1));
+
+        const size_t range_size = size / num_threads;
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+
+        try {
+            for (size_t i = 1; i < num_threads; i++) {
+                const size_t begin = i * range_size;
+                const size_t end = i + 1 < num_threads ? begin + range_size : size;
+                threads.emplace_back([&func, i, begin, end]() { func(i, begin, end); });
+            }
+
+            func(0, 0, range_size);
+        }
+        catch (...) {
+            // the started threads must be joined before the destruction, otherwise it is `std::terminate`
+            for (auto & thread : threads) {
+                thread.join();
+            }
+            throw;
+        }
+
+        for (auto & thread : threads) {
+            thread.join();
+        }
+    }
+
+    // number of equal bytes in the both arrays
+    uint64_t _count_equal_bytes(const uint8_t * left, const uint8_t * right, size_t size)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i sum = zero;
+
+        const size_t whole_size = size - size % 16;
+        size_t offset = 0;
+
+        while (offset < whole_size) {
+            __m128i counters = zero;
+
+            // 8-bit counters overflow after 255 increments
+            const size_t block_end = (std::min)(offset + 255 * 16, whole_size);
+            for (; offset < block_end; offset += 16) {
+                const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(left + offset)), _mm_loadu_si128((const __m128i *)(right + offset)));
+                counters = _mm_sub_epi8(counters, eq); // eq is -1 for equal bytes
+            }
+
+            sum = _mm_add_epi64(sum, _mm_sad_epu8(counters, zero));
+        }
+
+        uint64_t lanes[2];
+        _mm_storeu_si128((__m128i *)lanes, sum);
+
+        uint64_t count = lanes[0] + lanes[1];
+
+        for (; offset < size; offset++) {
+            count += (left[offset] == right[offset]);
+        }
+
+        return count;
+    }
+
+    size_t _select_period(const std::vector<double> & coincidence)
+    {
+        ASSERT_GE(coincidence.size(), 2U);
+
+        std::vector<double> sorted(coincidence.begin() + 1, coincidence.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        const double median = sorted[sorted.size() / 2];
+        const double best = sorted.back();
+
+        // Multiples of the xor value size have the coincidence near to the best, so the smallest period near to the
+        // best wins.
+        const double threshold = median + (best - median) * 0.8;
+
+        for (size_t period = 1; period < coincidence.size(); period++) {
+            if (coincidence[period] >= threshold) {
+                return period;
+            }
+        }
+
+        return 1;
+    }
+
+    struct ColumnsUserData
+    {
+        size_t                  period;
+        size_t                  num_threads;
+        uint64_t                offset;
+        std::vector<uint64_t>   histograms; // `period` columns by 256 counters
+    };
+
+    void _read_columns_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        ColumnsUserData & data = *static_cast<ColumnsUserData *>(user_data);
+
+        const size_t period = data.period;
+        const size_t histograms_size = period * 256;
+
+        std::vector<std::vector<uint32_t> > thread_histograms(data.num_threads);
+
+        _parallel_for_ranges(size_t(size), data.num_threads, [&](size_t thread_index, size_t begin, size_t end) {
+            std::vector<uint32_t> & histograms = thread_histograms[thread_index];
+            histograms.resize(histograms_size);
+
+            size_t column = size_t((data.offset + begin) % period);
+
+            for (size_t i = begin; i < end; i++) {
+                histograms[column * 256 + buf[i]]++;
+                if (++column == period) {
+                    column = 0;
+                }
+            }
+        });
+
+        for (const auto & histograms : thread_histograms) {
+            for (size_t i = 0; i < histograms.size(); i++) {
+                data.histograms[i] += histograms[i];
+            }
+        }
+
+        data.offset += size;
+    }
+
+    // block size to score against all the candidates, must stay in the L2 cache
+    const size_t s_score_block_size = 64 * 1024;
+
+    struct ScoreUserData
+    {
+        const std::vector<std::vector<uint8_t> > *  xor_values;
+        const std::vector<uint8_t> *                magic;
+        size_t                                      num_threads;
+        uint64_t                                    offset;
+        std::vector<std::vector<uint64_t> >         histograms; // per candidate
+        std::vector<uint8_t>                        magic_matched;
+    };
+
+    void _read_score_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        ScoreUserData & data = *static_cast<ScoreUserData *>(user_data);
+
+        const std::vector<std::vector<uint8_t> > & xor_values = *data.xor_values;
+        const std::vector<uint8_t> & magic = *data.magic;
+
+        _parallel_for_ranges(xor_values.size(), data.num_threads, [&](size_t, size_t begin, size_t end) {
+            // 4 interleaved histograms to break the store to load dependency on the same counter
+            uint32_t local_histograms[4][256];
+
+            for (size_t block_offset = 0; block_offset < size; block_offset += s_score_block_size) {
+                const size_t block_size = size_t((std::min)(uint64_t(s_score_block_size), size - block_offset));
+                const uint8_t * block = buf + block_offset;
+
+                for (size_t index = begin; index < end; index++) {
+                    const std::vector<uint8_t> & xor_value = xor_values[index];
+                    const size_t xor_value_size = xor_value.size();
+
+                    memset(local_histograms, 0, sizeof(local_histograms));
+
+                    size_t column = size_t((data.offset + block_offset) % xor_value_size);
+                    size_t i = 0;
+
+                    for (; i + 4 <= block_size; i += 4) {
+                        local_histograms[0][block[i] ^ xor_value[column]]++;
+                        if (++column == xor_value_size) column = 0;
+                        local_histograms[1][block[i + 1] ^ xor_value[column]]++;
+                        if (++column == xor_value_size) column = 0;
+                        local_histograms[2][block[i + 2] ^ xor_value[column]]++;
+                        if (++column == xor_value_size) column = 0;
+                        local_histograms[3][block[i + 3] ^ xor_value[column]]++;
+                        if (++column == xor_value_size) column = 0;
+                    }
+                    for (; i < block_size; i++) {
+                        local_histograms[0][block[i] ^ xor_value[column]]++;
+                        if (++column == xor_value_size) column = 0;
+                    }
+
+                    std::vector<uint64_t> & histogram = data.histograms[index];
+                    for (size_t j = 0; j < 256; j++) {
+                        histogram[j] += local_histograms[0][j] + local_histograms[1][j] + local_histograms[2][j] + local_histograms[3][j];
+                    }
+                }
+            }
+
+            // the magic bytes can cross the first chunk end only if the file is smaller than the magic
+            if (!data.offset && !magic.empty()) {
+                for (size_t index = begin; index < end; index++) {
+                    const std::vector<uint8_t> & xor_value = xor_values[index];
+
+                    bool matched = (magic.size() <= size);
+                    for (size_t i = 0; matched && i < magic.size(); i++) {
+                        matched = ((buf[i] ^ xor_value[i % xor_value.size()]) == magic[i]);
+                    }
+
+                    data.magic_matched[index] = matched;
+                }
+            }
+        });
+
+        data.offset += size;
+    }
+}
+
+XorValueAnalysis analyze_xor_value(const tackle::FileHandle & file_handle, size_t max_period, uint8_t plain_byte, size_t num_threads)
+{
+    ASSERT_TRUE(file_handle.get());
+
+    if (!max_period) {
+        throw std::runtime_error(BOOST_PP_CAT(__FUNCTION__, ": max period must be not 0"));
+    }
+
+    if (!num_threads) {
+        num_threads = (std::max)(std::thread::hardware_concurrency(), 1U);
+    }
+
+    XorValueAnalysis analysis;
+
+    // period detection
+
+    const uint64_t file_size = utility::get_file_size(file_handle);
+    const size_t sample_size = size_t((std::min)(file_size, uint64_t(s_max_period_sample_size)));
+
+    if (sample_size <= max_period) {
+        throw std::runtime_error(
+            (boost::format(
+                BOOST_PP_CAT(__FUNCTION__, ": file is too small for the max period: size=%llu max_period=%u")) %
+                    file_size % max_period).str());
+    }
+
+    std::vector<uint8_t> sample(sample_size);
+
+    const size_t read_size = fread(&sample[0], 1, sample_size, file_handle.get());
+    const int file_read_err = ferror(file_handle.get());
+    if (read_size < sample_size) {
+        utility::debug_break();
+        throw std::system_error{ file_read_err, std::system_category(), file_handle.path() };
+    }
+
+    analysis.coincidence.resize(max_period + 1);
+
+    // each thread takes a whole set of periods over the whole sample
+    _parallel_for_ranges(max_period, num_threads, [&](size_t, size_t begin, size_t end) {
+        for (size_t period = begin + 1; period <= end; period++) {
+            const size_t num_pairs = sample_size - period;
+            analysis.coincidence[period] = double(_count_equal_bytes(&sample[0], &sample[period], num_pairs)) / num_pairs;
+        }
+    });
+
+    analysis.period = _select_period(analysis.coincidence);
+
+    sample.clear();
+    sample.shrink_to_fit();
+
+    // xor value recovery
+
+    if (fseek(file_handle.get(), 0, SEEK_SET)) {
+        utility::debug_break();
+        throw std::system_error{ errno, std::system_category(), file_handle.path() };
+    }
+
+    ColumnsUserData columns_user_data;
+    columns_user_data.period = analysis.period;
+    columns_user_data.num_threads = num_threads;
+    columns_user_data.offset = 0;
+    columns_user_data.histograms.resize(analysis.period * 256);
+
+    tackle::FileReader(file_handle, _read_columns_chunk).do_read(&columns_user_data, {}, 0, s_max_read_chunk_size);
+
+    analysis.xor_value.resize(analysis.period);
+
+    for (size_t column = 0; column < analysis.period; column++) {
+        const uint64_t * histogram = &columns_user_data.histograms[column * 256];
+        const size_t most_frequent_byte = size_t(std::max_element(histogram, histogram + 256) - histogram);
+        analysis.xor_value[column] = uint8_t(most_frequent_byte ^ plain_byte);
+    }
+
+    return analysis;
+}
+
+std::vector<XorValueScore> score_xor_values(const tackle::FileHandle & file_handle, const std::vector<std::vector<uint8_t> > & xor_values,
+    const std::vector<uint8_t> & magic, size_t num_threads)
+{
+    ASSERT_TRUE(file_handle.get());
+
+    for (const auto & xor_value : xor_values) {
+        if (xor_value.empty()) {
+            throw std::runtime_error(BOOST_PP_CAT(__FUNCTION__, ": xor value must be not empty"));
+        }
+    }
+
+    if (!num_threads) {
+        num_threads = (std::max)(std::thread::hardware_concurrency(), 1U);
+    }
+
+    ScoreUserData score_user_data;
+    score_user_data.xor_values = &xor_values;
+    score_user_data.magic = &magic;
+    score_user_data.num_threads = num_threads;
+    score_user_data.offset = 0;
+    score_user_data.histograms.resize(xor_values.size(), std::vector<uint64_t>(256));
+    score_user_data.magic_matched.resize(xor_values.size());
+
+    tackle::FileReader(file_handle, _read_score_chunk).do_read(&score_user_data, {}, 0, s_max_read_chunk_size);
+
+    std::vector<XorValueScore> scores(xor_values.size());
+
+    for (size_t index = 0; index < xor_values.size(); index++) {
+        const std::vector<uint64_t> & histogram = score_user_data.histograms[index];
+
+        uint64_t num_bytes = 0;
+        uint64_t num_printable = 0;
+
+        for (size_t byte = 0; byte < 256; byte++) {
+            num_bytes += histogram[byte];
+            if ((byte >= 0x20 && byte < 0x7F) || byte == '\t' || byte == '\n' || byte == '\r') {
+                num_printable += histogram[byte];
+            }
+        }
+
+        double entropy = 0;
+
+        if (num_bytes) {
+            for (size_t byte = 0; byte < 256; byte++) {
+                if (histogram[byte]) {
+                    const double probability = double(histogram[byte]) / num_bytes;
+                    entropy -= probability * std::log2(probability);
+                }
+            }
+        }
+
+        XorValueScore & score = scores[index];
+        score.index = index;
+        score.entropy = entropy;
+        score.printable_ratio = num_bytes ? double(num_printable) / num_bytes : 0;
+        score.magic_matched = score_user_data.magic_matched[index] ? true : false;
+    }
+
+    return scores;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <tacklelib.hpp>
+
+#include <utility/platform.hpp>
+
+#include <tackle/file_handle.hpp>
+
+#include <vector>
+#include <cstdint>
+
+
+struct XorValueAnalysis
+{
+    size_t                  period;         // detected xor value size in bytes
+    std::vector<double>     coincidence;    // rate of equal bytes at distance `i` for the index `i` (index 0 is unused)
+    std::vector<uint8_t>    xor_value;      // recovered xor value, applied from the file beginning
+};
+
+// Analyzes a file xored by an unknown repeating xor value:
+//  1. Detects the xor value size by the coincidence (autocorrelation) profile over the candidate periods
+//     `[1, max_period]`, computed on the file beginning. The plain data bytes are not uniformly distributed, so the
+//     bytes at a distance multiple of the xor value size are equal much more often than at any other distance.
+//  2. Recovers the xor value by the frequency analysis of each column of the detected period over the whole file,
+//     where the most frequent byte in a column is expected to be `plain_byte` in the plain data.
+//
+// Both passes are splitted between `num_threads` threads by data blocks.
+//
+XorValueAnalysis analyze_xor_value(const tackle::FileHandle & file_handle, size_t max_period, uint8_t plain_byte, size_t num_threads);
+
+struct XorValueScore
+{
+    size_t      index;              // index of the xor value in the candidate list
+    double      entropy;            // entropy of the xored data in bits per byte
+    double      printable_ratio;    // ratio of the printable ASCII characters (including tab and line returns) in the xored data
+    bool        magic_matched;      // xored data begins by the magic bytes (if any)
+};
+
+// Scores a list of candidate xor values (applied from the file beginning) in a single read of the file:
+//  each read chunk is splitted by cache sized blocks and each block is scored against all the candidates before the
+//  next block, while the candidates are splitted between `num_threads` threads.
+//
+std::vector<XorValueScore> score_xor_values(const tackle::FileHandle & file_handle, const std::vector<std::vector<uint8_t> > & xor_values,
+    const std::vector<uint8_t> & magic, size_t num_threads);
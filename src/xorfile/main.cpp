@@ -1,185 +1,425 @@
-#include "main.hpp"
-
-#include "utility/utility.hpp"
-#include "utility/assert.hpp"
-
-#include "tackle/file_reader.hpp"
-
-#include <boost/program_options.hpp>
-#include <boost/filesystem.hpp>
-
-#include <string>
-#include <iostream>
-#include <vector>
-
-#include <stdio.h>
-#include <stdlib.h>
-
-namespace po = boost::program_options;
-using namespace utility;
-
-namespace boost {
-    namespace fs = filesystem;
-}
-
-namespace
-{
-    struct UserData
-    {
-        std::vector<uint8_t> xor_value;
-        FileHandle file_out_handle;
-    };
-
-    void xor_buffer(uint8_t * buf, uint32_t size, const std::vector<uint8_t> & xor_value = { 0xff, 0xff, 0xff, 0xff })
-    {
-        ASSERT_TRUE(buf && size);
-        uint32_t buf_offset = 0;
-        const size_t xor_value_size = xor_value.size();
-        const uint32_t num_wholes = size / xor_value_size;
-        for (uint32_t i = 0; i < num_wholes; i++)
-        {
-            switch (xor_value_size) {
-            case 64:
-                *(uint64_t*)(buf + buf_offset) = *(uint64_t*)&xor_value[0];
-                break;
-            case 32:
-                *(uint32_t*)(buf + buf_offset) = *(uint32_t*)&xor_value[0];
-                break;
-            default:
-                for (size_t i = 0; i < xor_value_size; i++) {
-                    (buf + buf_offset)[i] ^= xor_value[i];
-                }
-            }
-            buf_offset += xor_value_size;
-        }
-
-        const uint32_t reminder = size % xor_value_size;
-        if (reminder) {
-            for (size_t i = 0; i < reminder; i++) {
-                (buf + buf_offset)[i] ^= xor_value[i];
-            }
-        }
-    }
-
-    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
-    {
-        if (sizeof(size_t) < sizeof(uint64_t)) {
-            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
-            if (size > max_value) {
-                throw std::runtime_error(
-                    (boost::format(
-                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
-                        size).str());
-            }
-        }
-
-        const UserData & data = *static_cast<UserData *>(user_data);
-
-        const size_t read_size = uint32_t(size);
-
-        xor_buffer(buf, read_size, data.xor_value);
-
-        const size_t write_size = fwrite(buf, 1, read_size, data.file_out_handle.get());
-        const int file_write_err = ferror(data.file_out_handle.get());
-        if (write_size < read_size) {
-            utility::debug_break();
-            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
-        }
-    }
-}
-
-int main(int argc, char* argv[])
-{
-    try {
-        std::string in_file;
-        std::string out_file;
-        std::string num_xor_bits_str;
-
-        po::options_description desc("Allowed options");
-        desc.add_options()
-            ("help,h", "print usage message")
-            ("input,i",
-                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
-            ("output,o",
-                po::value(&out_file), "output file")
-            ("xor_bits,b",
-                po::value(&num_xor_bits_str), "number of first bits in the file to XOR with")
-        ;
-
-        po::positional_options_description p;
-        p.add("input", 1);
-        p.add("xor_bits", 1);
-
-        po::variables_map vm;
-        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
-        po::notify(vm); // important, otherwise related option variables won't be initialized
-
-        if (vm.count("help")) {
-            std::cout << desc << "\n";
-            return 0;
-        }
-
-        if (!boost::fs::exists(in_file)) {
-            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
-            return 1;
-        }
-
-        if (in_file == out_file) {
-            fprintf(stderr, "error: output file should not be input\n");
-            return 2;
-        }
-
-        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
-
-        boost::fs::path in_file_path = boost::fs::path(in_file);
-
-        if (out_file.empty()) {
-            const std::string & out_parent_path = in_file_path.parent_path().string();
-            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_xor" + in_file_path.extension().string();
-        }
-
-        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
-
-        typedef std::shared_ptr<uint8_t> ReadBufSharedPtr;
-
-        std::vector<uint8_t> xor_value = { 0xff, 0xff, 0xff, 0xff };
-        uint32_t bit_size = 32;
-        if (!num_xor_bits_str.empty()) {
-            bit_size = std::stoul(num_xor_bits_str, 0, 0);
-        }
-        if (bit_size > 1024 * 1024) {
-            bit_size = 1024 * 1024 * CHAR_BIT;
-        }
-
-        uint32_t next_read_size = (bit_size + CHAR_BIT - 1) / CHAR_BIT;
-        size_t read_size = 0;
-        size_t write_size = 0;
-
-        // read the xor value from the file beginning
-        xor_value.resize(next_read_size);
-        read_size = fread(&xor_value[0], 1, next_read_size, file_in_handle.get());
-        const int file_read_err = ferror(file_in_handle.get());
-        if (read_size < next_read_size) {
-            utility::debug_break();
-            throw std::system_error{ file_read_err, std::system_category(), file_in_handle.path() };
-        }
-
-        write_size = fwrite(&xor_value[0], 1, read_size, file_out_handle.get());
-        const int file_write_err = ferror(file_out_handle.get());
-        if (write_size < read_size) {
-            utility::debug_break();
-            throw std::system_error{ file_write_err, std::system_category(), file_out_handle.path() };
-        }
-
-        UserData user_data;
-        user_data.xor_value = xor_value;
-        user_data.file_out_handle = file_out_handle;
-        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, next_read_size);
-    }
-    catch (std::exception & e) {
-        std::cerr << e.what() << "\n";
-        return -1;
-    }
-
-    return 0;
-}
+#include "main.hpp"
+#include "analysis.hpp"
+
+#include "utility/utility.hpp"
+#include "utility/assert.hpp"
+
+#include "tackle/file_reader.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace po = boost::program_options;
+using namespace utility;
+
+namespace boost {
+    namespace fs = filesystem;
+}
+
+namespace
+{
+    typedef void (* XorFunc)(uint8_t * buf, uint32_t size, const std::vector<uint8_t> & xor_value);
+
+    struct UserData
+    {
+        std::vector<uint8_t> xor_value;
+        XorFunc xor_func;
+        FileHandle file_out_handle;
+    };
+
+    // key tile size for the blocked xor, the key tile and the data tile must fit together into the L1 data cache
+    const size_t s_xor_tile_size = 8 * 1024;
+
+    // maximum size of a read chunk, rounded down to a multiple of the xor value size
+    const size_t s_max_read_chunk_size = 64 * 1024 * 1024;
+
+    FORCE_INLINE void xor_span(uint8_t * buf, const uint8_t * xor_value, size_t size, const uint8_t * prefetch_buf)
+    {
+        size_t offset = 0;
+
+        for (; offset + 64 <= size; offset += 64) {
+            // prefetch is a hint and does not fault on an address outside of the buffer
+            _mm_prefetch((const char *)(prefetch_buf + offset), _MM_HINT_T0);
+
+            const __m128i v0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset)), _mm_loadu_si128((const __m128i *)(xor_value + offset)));
+            const __m128i v1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 16)), _mm_loadu_si128((const __m128i *)(xor_value + offset + 16)));
+            const __m128i v2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 32)), _mm_loadu_si128((const __m128i *)(xor_value + offset + 32)));
+            const __m128i v3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 48)), _mm_loadu_si128((const __m128i *)(xor_value + offset + 48)));
+
+            _mm_storeu_si128((__m128i *)(buf + offset), v0);
+            _mm_storeu_si128((__m128i *)(buf + offset + 16), v1);
+            _mm_storeu_si128((__m128i *)(buf + offset + 32), v2);
+            _mm_storeu_si128((__m128i *)(buf + offset + 48), v3);
+        }
+
+        for (; offset < size; offset++) {
+            buf[offset] ^= xor_value[offset];
+        }
+    }
+
+    // Xor value of a fixed size, which is a divisor of 64:
+    //  The xor value is broadcasted once into a 64 byte pattern held by 4 registers and the buffer is xored by 64 byte
+    //  blocks without any per block dispatch.
+    //
+    template <size_t N>
+    void xor_buffer_t(uint8_t * buf, uint32_t size, const std::vector<uint8_t> & xor_value)
+    {
+        STATIC_ASSERT_TRUE(N && !(64 % N), "N must be a divisor of 64");
+        ASSERT_TRUE(buf && size);
+        ASSERT_EQ(xor_value.size(), N);
+
+        uint8_t pattern[64];
+        for (size_t i = 0; i < 64; i++) {
+            pattern[i] = xor_value[i % N];
+        }
+
+        const __m128i k0 = _mm_loadu_si128((const __m128i *)pattern);
+        const __m128i k1 = _mm_loadu_si128((const __m128i *)(pattern + 16));
+        const __m128i k2 = _mm_loadu_si128((const __m128i *)(pattern + 32));
+        const __m128i k3 = _mm_loadu_si128((const __m128i *)(pattern + 48));
+
+        uint32_t offset = 0;
+
+        for (; offset + 64 <= size; offset += 64) {
+            _mm_storeu_si128((__m128i *)(buf + offset), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset)), k0));
+            _mm_storeu_si128((__m128i *)(buf + offset + 16), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 16)), k1));
+            _mm_storeu_si128((__m128i *)(buf + offset + 32), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 32)), k2));
+            _mm_storeu_si128((__m128i *)(buf + offset + 48), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(buf + offset + 48)), k3));
+        }
+
+        // the offset is a multiple of 64 here, so the pattern starts from the beginning
+        for (size_t i = 0; offset < size; offset++, i++) {
+            buf[offset] ^= pattern[i];
+        }
+    }
+
+    void xor_buffer_generic(uint8_t * buf, uint32_t size, const std::vector<uint8_t> & xor_value)
+    {
+        ASSERT_TRUE(buf && size);
+        const size_t xor_value_size = xor_value.size();
+        for (size_t buf_offset = 0; buf_offset < size; buf_offset += xor_value_size) {
+            xor_span(buf + buf_offset, &xor_value[0], (std::min)(xor_value_size, size - buf_offset), buf + buf_offset + xor_value_size);
+        }
+    }
+
+    // Blocked xor for big xor values (up to 1MB):
+    //  The buffer is walked by key tiles instead of key periods. Each key tile is applied to the same tile of all
+    //  periods in the buffer before the next key tile, so the key tile stays in the L1 cache and only the data stream
+    //  goes through the memory. The data tile of the next period is prefetched while the current one is processed.
+    //
+    void xor_buffer_blocked(uint8_t * buf, uint32_t size, const std::vector<uint8_t> & xor_value)
+    {
+        ASSERT_TRUE(buf && size);
+        const size_t xor_value_size = xor_value.size();
+        for (size_t tile_offset = 0; tile_offset < xor_value_size && tile_offset < size; tile_offset += s_xor_tile_size) {
+            const size_t tile_size = (std::min)(s_xor_tile_size, xor_value_size - tile_offset);
+            for (size_t buf_offset = tile_offset; buf_offset < size; buf_offset += xor_value_size) {
+                xor_span(buf + buf_offset, &xor_value[tile_offset], (std::min)(tile_size, size - buf_offset), buf + buf_offset + xor_value_size);
+            }
+        }
+    }
+
+    // resolves the xor implementation once per run instead of a dispatch per xor value block
+    XorFunc get_xor_func(size_t xor_value_size)
+    {
+        switch (xor_value_size) {
+        case 1: return xor_buffer_t<1>;
+        case 2: return xor_buffer_t<2>;
+        case 4: return xor_buffer_t<4>;
+        case 8: return xor_buffer_t<8>;
+        case 16: return xor_buffer_t<16>;
+        case 32: return xor_buffer_t<32>;
+        case 64: return xor_buffer_t<64>;
+        }
+
+        return xor_value_size > s_xor_tile_size ? xor_buffer_blocked : xor_buffer_generic;
+    }
+
+    std::vector<uint8_t> parse_hex_bytes(std::string str)
+    {
+        if (str.size() >= 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
+            str.erase(0, 2);
+        }
+
+        if (str.empty() || str.size() % 2) {
+            throw std::runtime_error(
+                (boost::format(
+                    BOOST_PP_CAT(__FUNCTION__, ": hex string must have not zero even length: \"%s\"")) %
+                        str).str());
+        }
+
+        std::vector<uint8_t> bytes(str.size() / 2);
+        for (size_t i = 0; i < bytes.size(); i++) {
+            size_t parsed_size = 0;
+            bytes[i] = uint8_t(std::stoul(str.substr(i * 2, 2), &parsed_size, 16));
+            if (parsed_size != 2) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": invalid hex string: \"%s\"")) %
+                            str).str());
+            }
+        }
+
+        return bytes;
+    }
+
+    // one hex value per line, empty lines and lines beginning by `#` are skipped
+    std::vector<std::vector<uint8_t> > read_hex_values_file(const std::string & file_path)
+    {
+        std::ifstream file{ file_path };
+        if (!file) {
+            throw std::system_error{ errno, std::system_category(), file_path };
+        }
+
+        std::vector<std::vector<uint8_t> > values;
+
+        std::string line;
+        while (std::getline(file, line)) {
+            line.erase(0, line.find_first_not_of(" \t"));
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            values.push_back(parse_hex_bytes(line));
+        }
+
+        return values;
+    }
+
+    void _read_file_chunk(uint8_t * buf, uint64_t size, void * user_data)
+    {
+        if (sizeof(size_t) < sizeof(uint64_t)) {
+            const uint64_t max_value = uint64_t((std::numeric_limits<size_t>::max)());
+            if (size > max_value) {
+                throw std::runtime_error(
+                    (boost::format(
+                        BOOST_PP_CAT(__FUNCTION__, ": size is out of buffer: size=%llu")) %
+                        size).str());
+            }
+        }
+
+        const UserData & data = *static_cast<UserData *>(user_data);
+
+        const size_t read_size = uint32_t(size);
+
+        data.xor_func(buf, read_size, data.xor_value);
+
+        const size_t write_size = fwrite(buf, 1, read_size, data.file_out_handle.get());
+        const int file_write_err = ferror(data.file_out_handle.get());
+        if (write_size < read_size) {
+            utility::debug_break();
+            throw std::system_error{ file_write_err, std::system_category(), data.file_out_handle.path() };
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        std::string in_file;
+        std::string out_file;
+        std::string num_xor_bits_str;
+        bool analyze = false;
+        size_t max_period = 256;
+        std::string plain_byte_str;
+        size_t num_threads = 0;
+        std::string keys_file;
+        std::string score_str = "printable";
+        std::string magic_str;
+        size_t num_top = 16;
+
+        po::options_description desc("Allowed options");
+        desc.add_options()
+            ("help,h", "print usage message")
+            ("input,i",
+                po::value(&in_file), "input file and output file prefix if output file is not set explicitly")
+            ("output,o",
+                po::value(&out_file), "output file")
+            ("xor_bits,b",
+                po::value(&num_xor_bits_str), "number of first bits in the file to XOR with")
+            ("analyze,a",
+                po::bool_switch(&analyze), "analyze the input file xored by an unknown repeating value: detect the value size and recover the value (the output file is written only if set explicitly)")
+            ("max_period",
+                po::value(&max_period), "analyze: maximum value size in bytes to check (default: 256)")
+            ("plain_byte",
+                po::value(&plain_byte_str), "analyze: most frequent byte in the plain data (default: 0x00)")
+            ("threads,t",
+                po::value(&num_threads), "analyze/keys: number of threads (default: number of cores)")
+            ("keys,k",
+                po::value(&keys_file), "score candidate xor values from the file (a hex value per line) applied from the input file beginning, the input file is read once")
+            ("score",
+                po::value(&score_str), "keys: sort by score: `printable` - by printable characters ratio (default), `entropy` - by entropy ascending")
+            ("magic",
+                po::value(&magic_str), "keys: hex bytes the xored file must begin by, matched values are sorted first")
+            ("top",
+                po::value(&num_top), "keys: number of best values to print, 0 - all (default: 16)")
+        ;
+
+        po::positional_options_description p;
+        p.add("input", 1);
+        p.add("xor_bits", 1);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(p).run(), vm);
+        po::notify(vm); // important, otherwise related option variables won't be initialized
+
+        if (vm.count("help")) {
+            std::cout << desc << "\n";
+            return 0;
+        }
+
+        if (!boost::fs::exists(in_file)) {
+            fprintf(stderr, "error: input file is not found: \"%s\"\n", in_file.c_str());
+            return 1;
+        }
+
+        if (in_file == out_file) {
+            fprintf(stderr, "error: output file should not be input\n");
+            return 2;
+        }
+
+        FileHandle file_in_handle = open_file(in_file, "rb", _SH_DENYWR);
+
+        if (!keys_file.empty()) {
+            if (score_str != "printable" && score_str != "entropy") {
+                fprintf(stderr, "error: invalid score: \"%s\"\n", score_str.c_str());
+                return 3;
+            }
+
+            const std::vector<std::vector<uint8_t> > xor_values = read_hex_values_file(keys_file);
+            const std::vector<uint8_t> magic = !magic_str.empty() ? parse_hex_bytes(magic_str) : std::vector<uint8_t>{};
+
+            std::vector<XorValueScore> scores = score_xor_values(file_in_handle, xor_values, magic, num_threads);
+
+            const bool by_entropy = (score_str == "entropy");
+
+            std::stable_sort(scores.begin(), scores.end(), [&](const XorValueScore & left, const XorValueScore & right) {
+                if (left.magic_matched != right.magic_matched) {
+                    return left.magic_matched;
+                }
+                return by_entropy ? left.entropy < right.entropy : left.printable_ratio > right.printable_ratio;
+            });
+
+            if (num_top && num_top < scores.size()) {
+                scores.resize(num_top);
+            }
+
+            for (const auto & score : scores) {
+                printf("entropy=%.4f printable=%.4f magic=%u value=", score.entropy, score.printable_ratio, score.magic_matched ? 1U : 0U);
+                for (auto byte : xor_values[score.index]) {
+                    printf("%02x", byte);
+                }
+                puts("");
+            }
+
+            return 0;
+        }
+
+        if (analyze) {
+            const uint8_t plain_byte = uint8_t(!plain_byte_str.empty() ? std::stoul(plain_byte_str, 0, 0) : 0);
+
+            const XorValueAnalysis analysis = analyze_xor_value(file_in_handle, max_period, plain_byte, num_threads);
+
+            std::vector<size_t> periods;
+            for (size_t period = 1; period < analysis.coincidence.size(); period++) {
+                periods.push_back(period);
+            }
+            std::sort(periods.begin(), periods.end(), [&](size_t left, size_t right) {
+                return analysis.coincidence[left] > analysis.coincidence[right];
+            });
+            periods.resize((std::min)(periods.size(), size_t(8)));
+
+            printf("coincidence:");
+            for (auto period : periods) {
+                printf(" %u=%.4f", uint32_t(period), analysis.coincidence[period]);
+            }
+            printf("\nperiod: %u\nxor value: ", uint32_t(analysis.period));
+            for (auto byte : analysis.xor_value) {
+                printf("%02x", byte);
+            }
+            puts("");
+
+            if (out_file.empty()) {
+                return 0;
+            }
+
+            // write the input file xored by the recovered value from the file beginning
+            if (fseek(file_in_handle.get(), 0, SEEK_SET)) {
+                utility::debug_break();
+                throw std::system_error{ errno, std::system_category(), file_in_handle.path() };
+            }
+
+            UserData user_data;
+            user_data.xor_value = analysis.xor_value;
+            user_data.xor_func = get_xor_func(analysis.xor_value.size());
+            user_data.file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
+            const uint32_t max_read_size = uint32_t((std::max)(s_max_read_chunk_size / analysis.period, size_t(1)) * analysis.period);
+            tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, analysis.period, max_read_size);
+
+            return 0;
+        }
+
+        boost::fs::path in_file_path = boost::fs::path(in_file);
+
+        if (out_file.empty()) {
+            const std::string & out_parent_path = in_file_path.parent_path().string();
+            out_file = out_parent_path + (!out_parent_path.empty() ? "/" : "") + in_file_path.stem().string() + "_xor" + in_file_path.extension().string();
+        }
+
+        FileHandle file_out_handle = open_file(out_file, "wb", _SH_DENYWR);
+
+        typedef std::shared_ptr<uint8_t> ReadBufSharedPtr;
+
+        std::vector<uint8_t> xor_value = { 0xff, 0xff, 0xff, 0xff };
+        uint32_t bit_size = 32;
+        if (!num_xor_bits_str.empty()) {
+            bit_size = std::stoul(num_xor_bits_str, 0, 0);
+        }
+        if (bit_size > 1024 * 1024) {
+            bit_size = 1024 * 1024 * CHAR_BIT;
+        }
+
+        uint32_t next_read_size = (bit_size + CHAR_BIT - 1) / CHAR_BIT;
+        size_t read_size = 0;
+        size_t write_size = 0;
+
+        // read the xor value from the file beginning
+        xor_value.resize(next_read_size);
+        read_size = fread(&xor_value[0], 1, next_read_size, file_in_handle.get());
+        const int file_read_err = ferror(file_in_handle.get());
+        if (read_size < next_read_size) {
+            utility::debug_break();
+            throw std::system_error{ file_read_err, std::system_category(), file_in_handle.path() };
+        }
+
+        write_size = fwrite(&xor_value[0], 1, read_size, file_out_handle.get());
+        const int file_write_err = ferror(file_out_handle.get());
+        if (write_size < read_size) {
+            utility::debug_break();
+            throw std::system_error{ file_write_err, std::system_category(), file_out_handle.path() };
+        }
+
+        UserData user_data;
+        user_data.xor_value = xor_value;
+        user_data.xor_func = get_xor_func(xor_value.size());
+        user_data.file_out_handle = file_out_handle;
+        // the read chunk size must be a multiple of the xor value size to start each chunk from the xor value beginning
+        const uint32_t max_read_size = uint32_t((std::max)(s_max_read_chunk_size / next_read_size, size_t(1)) * next_read_size);
+        tackle::FileReader(file_in_handle, _read_file_chunk).do_read(&user_data, {}, next_read_size, max_read_size);
+    }
+    catch (std::exception & e) {
+        std::cerr << e.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}